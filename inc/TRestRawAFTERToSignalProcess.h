@@ -65,6 +65,22 @@ class TRestRawAFTERToSignalProcess : public TRestRawToSignalProcess {
     unsigned int prevTime;
     double reducedTime;
 
+    /// It enables the CRC verification of each data packet
+    Bool_t fCRCCheck = false;
+
+    /// If enabled, events containing a data packet with a wrong CRC are not returned
+    Bool_t fDropBadCRC = false;
+
+    /// It is set when the event being read contains a data packet with a wrong CRC
+    Bool_t fEventBadCRC = false;  //!
+
+    /// Buffer holding the samples of a data packet
+    std::vector<uint16_t> fPacketData;  //!
+
+    void InitFromConfigFile() override;
+
+    Bool_t ReadEvent();
+
    public:
     void Initialize() override;
     void InitProcess() override;
@@ -74,9 +90,16 @@ class TRestRawAFTERToSignalProcess : public TRestRawToSignalProcess {
 
     Bool_t isExternal() { return true; }
 
+    static uint32_t CalculateCRC32(const void* data, size_t len);
+
+    static uint32_t GetPacketCRC(const DataPacketHeader& header, const uint16_t* data, size_t nWords);
+
+    static Bool_t CheckPacketCRC(const DataPacketHeader& header, const uint16_t* data, size_t nWords,
+                                 const DataPacketEnd& end);
+
     TRestRawAFTERToSignalProcess();
     ~TRestRawAFTERToSignalProcess();
 
-    ClassDefOverride(TRestRawAFTERToSignalProcess, 1);
+    ClassDefOverride(TRestRawAFTERToSignalProcess, 2);
 };
 #endif
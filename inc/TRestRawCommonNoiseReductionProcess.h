@@ -50,8 +50,16 @@ class TRestRawCommonNoiseReductionProcess : public TRestEventProcess {
     /// Minimum number of signals required to apply the process.
     Int_t fMinSignalsRequired = 200;
 
+    /// The values of the signals at each bin, stored contiguously for each bin
+    std::vector<Double_t> fBinValues;  //!
+
+    /// The correction applied to each bin
+    std::vector<Double_t> fCorrections;  //!
+
     void Initialize() override;
 
+    void CalculateCorrections(Int_t n, Int_t nBins, Double_t baseLine);
+
     void LoadDefaultConfig();
 
    protected:
@@ -139,11 +139,10 @@ class TRestRawFEUDreamToSignalProcess : public TRestRawToSignalProcess {
     // Double_t fLastTimeStamp;
     const int NstripMax = 64;  // number of strips on each chip
     const int MaxPhysChannel = 512;
-    bool bad_event;         // flag to tag bad event
-    int line;               // line number
-    int Nevent, Nbadevent;  // current event number
-    int IDEvent = 0;        // ID of event in Feu header
-                            // double MaxThreshold;
+    bool bad_event;   // flag to tag bad event
+    int line;         // line number
+    int IDEvent = 0;  // ID of event in Feu header
+                      // double MaxThreshold;
 
    public:
     bool ReadFeuHeaders(FeuReadOut& feu);
@@ -163,7 +162,7 @@ class TRestRawFEUDreamToSignalProcess : public TRestRawToSignalProcess {
     // Destructor
     ~TRestRawFEUDreamToSignalProcess();
 
-    ClassDefOverride(TRestRawFEUDreamToSignalProcess, 1);
+    ClassDefOverride(TRestRawFEUDreamToSignalProcess, 2);
 };
 
 #endif
@@ -13,6 +13,9 @@
 ///                 Created as part of the conceptualization of existing REST
 ///                 software.
 ///                 Javier Galan
+///
+///             oct 2026:   The transforms are created once for each size
+///                 and reused by the following calls.
 ///_______________________________________________________________________________
 
 #ifndef RestCore_TRestRawFFT
@@ -24,9 +27,17 @@
 
 #include <iostream>
 
+class TVirtualFFT;
+
 class TRestRawFFT : public TObject {
+   private:
+    TVirtualFFT* fForwardFFT = nullptr;   //! cached R2C transform of size fNfft
+    TVirtualFFT* fBackwardFFT = nullptr;  //! cached C2R transform of size fNfft
+
+    TVirtualFFT* GetTransform(TVirtualFFT*& fft, const char* option);
+
    protected:
-    Int_t fNfft;
+    Int_t fNfft = 0;
 
     TArrayD fTimeReal;       // [fNfft]
     TArrayD fTimeImg;        // [fNfft]
@@ -40,6 +51,8 @@ class TRestRawFFT : public TObject {
 
     Double_t GetFrequencyNorm2(Int_t n);
 
+    Double_t GetTimeAmplitudeReal(Int_t n) { return fTimeReal.GetArray()[n]; }
+
     inline Int_t GetNfft() const { return fNfft; }
 
     void GetSignal(TRestRawSignal* sgnl);
@@ -79,6 +92,9 @@ class TRestRawFFT : public TObject {
 
     // Constructor
     TRestRawFFT();
+    // The cached transforms are not shared by the copies
+    TRestRawFFT(const TRestRawFFT& fft);
+    TRestRawFFT& operator=(const TRestRawFFT& fft);
     // Destructor
     ~TRestRawFFT();
 
@@ -0,0 +1,85 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestDAQ_TRestRawHitListEvent
+#define RestDAQ_TRestRawHitListEvent
+
+#include <TPad.h>
+#include <TRestEvent.h>
+
+#include <vector>
+
+//! A compact event container storing the hits found at the raw signals as flat arrays
+class TRestRawHitListEvent : public TRestEvent {
+   protected:
+    /// The signal, or channel, ID of each hit
+    std::vector<Int_t> fSignalIds;
+
+    /// The time, in bins of the acquisition window, of the maximum of each hit
+    std::vector<Float_t> fTimes;
+
+    /// The baseline corrected amplitude of each hit
+    std::vector<Float_t> fAmplitudes;
+
+    /// The baseline corrected integral of each hit
+    std::vector<Float_t> fIntegrals;
+
+    /// The width, in bins, of each hit
+    std::vector<Float_t> fWidths;
+
+   public:
+    void AddHit(Int_t signalId, Float_t time, Float_t amplitude, Float_t integral, Float_t width);
+
+    void Reserve(size_t nHits);
+
+    /// Returns the number of hits in the event
+    inline Int_t GetNumberOfHits() const { return fSignalIds.size(); }
+
+    inline Int_t GetSignalId(Int_t n) const { return fSignalIds[n]; }
+    inline Float_t GetTime(Int_t n) const { return fTimes[n]; }
+    inline Float_t GetAmplitude(Int_t n) const { return fAmplitudes[n]; }
+    inline Float_t GetIntegral(Int_t n) const { return fIntegrals[n]; }
+    inline Float_t GetWidth(Int_t n) const { return fWidths[n]; }
+
+    inline const std::vector<Int_t>& GetSignalIds() const { return fSignalIds; }
+    inline const std::vector<Float_t>& GetTimes() const { return fTimes; }
+    inline const std::vector<Float_t>& GetAmplitudes() const { return fAmplitudes; }
+    inline const std::vector<Float_t>& GetIntegrals() const { return fIntegrals; }
+    inline const std::vector<Float_t>& GetWidths() const { return fWidths; }
+
+    Double_t GetTotalAmplitude() const;
+    Double_t GetTotalIntegral() const;
+
+    // Default
+    void Initialize();
+    void PrintEvent();
+
+    TPad* DrawEvent(const TString& option = "");
+
+    // Constructor
+    TRestRawHitListEvent();
+    // Destructor
+    virtual ~TRestRawHitListEvent();
+
+    ClassDef(TRestRawHitListEvent, 1);
+};
+#endif
@@ -110,6 +110,8 @@ class TRestRawMultiCoBoAsAdToSignalProcess : public TRestRawToSignalProcess {
 
     int fCurrentEvent = -1;  //!
     int fNextEvent = -1;     //!
+
+    bool fEventRejected = false;  //! set when the header pre-filter rejects the current event
 #endif
 
    public:
@@ -36,6 +36,24 @@ class TRestRawMultiFEMINOSToSignalProcess : public TRestRawToSignalProcess {
 
     Int_t fCounter = 0;  //!
 
+    /// DAQ channel ranges to be decoded. If empty all channels are decoded.
+    std::vector<TVector2> fSelectedChannelRanges;
+
+    /// A bitmap indexed by DAQ channel id built from fSelectedChannelRanges at InitProcess.
+    std::vector<Bool_t> fChannelSelected;  //!
+
+    /// It is set when the header pre-filter rejects the event being decoded
+    Bool_t fRejectEvent = false;  //!
+
+    /// The event type found at the last start of event header
+    Int_t fLastEventType = -1;  //!
+
+    template <Bool_t verbose>
+    Bool_t DecodeFrame(void* fr, int fr_sz);
+
+   protected:
+    void InitFromConfigFile() override;
+
    public:
     void InitProcess() override;
     void Initialize() override;
@@ -44,6 +62,12 @@ class TRestRawMultiFEMINOSToSignalProcess : public TRestRawToSignalProcess {
 
     Bool_t ReadFrame(void* fr, int fr_sz);
 
+    /// Returns true if the given DAQ channel will be decoded
+    inline Bool_t IsChannelSelected(Int_t daqChannel) const {
+        return fChannelSelected.empty() ||
+               (daqChannel < (Int_t)fChannelSelected.size() && fChannelSelected[daqChannel]);
+    }
+
     // Constructor
     TRestRawMultiFEMINOSToSignalProcess();
     TRestRawMultiFEMINOSToSignalProcess(const char* configFilename);
@@ -51,7 +75,7 @@ class TRestRawMultiFEMINOSToSignalProcess : public TRestRawToSignalProcess {
     ~TRestRawMultiFEMINOSToSignalProcess();
 
     ClassDefOverride(TRestRawMultiFEMINOSToSignalProcess,
-                     1);  // Template for a REST "event process" class inherited from
+                     2);  // Template for a REST "event process" class inherited from
                           // TRestEventProcess
 };
 #endif
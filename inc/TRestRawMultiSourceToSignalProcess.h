@@ -0,0 +1,128 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawMultiSourceToSignalProcess
+#define RestCore_TRestRawMultiSourceToSignalProcess
+
+#include <queue>
+
+#include "TRestRawToSignalProcess.h"
+
+//! A process building events from several raw decoders merged by timestamp
+class TRestRawMultiSourceToSignalProcess : public TRestRawToSignalProcess {
+   private:
+    /// The maximum number of sources, given by the bits of the sourcesMask observable
+    static constexpr size_t kMaxSources = 31;
+
+    /// An event decoded by one of the sources waiting to be merged
+    struct PendingEvent {
+        Double_t time;
+        Long64_t serial;
+        Int_t source;
+        TRestRawSignalEvent* event;
+
+        bool operator>(const PendingEvent& e) const {
+            return time > e.time || (time == e.time && serial > e.serial);
+        }
+    };
+
+    /// The class name of the decoder used by each source
+    std::vector<std::string> fSourceTypes;
+
+    /// The name of the decoder section inside the source configuration file
+    std::vector<std::string> fSourceNames;
+
+    /// The RML file where each source decoder is defined. The builder file is used if not given.
+    std::vector<std::string> fSourceConfigs;
+
+    /// The input file pattern of each source. The run input files are used if not given.
+    std::vector<std::string> fSourceFiles;
+
+    /// The offset added to the signal ids of each source
+    std::vector<Int_t> fSourceIdOffsets;
+
+    /// The offset, in seconds, added to the event timestamps of each source
+    std::vector<Double_t> fSourceTimeOffsets;
+
+    /// Maximum time difference, in seconds, to the earliest event of a combined event
+    Double_t fCoincidenceWindow = 1.e-6;
+
+    /// Maximum number of events read ahead, and time ordered, for each source
+    Int_t fBufferDepth = 8;
+
+    /// If true, combined events without an event from the first source are discarded
+    Bool_t fRequirePrimary = false;
+
+    /// Number of combined events discarded because the primary source was missing
+    Long64_t fOrphanEvents = 0;
+
+    /// Number of events merged from each source
+    std::vector<Long64_t> fSourceEvents;
+
+    std::vector<TRestRawToSignalProcess*> fSources;  //!
+    std::vector<std::string> fRunInputFiles;         //!
+
+    std::priority_queue<PendingEvent, std::vector<PendingEvent>, std::greater<PendingEvent>> fQueue;  //!
+
+    std::vector<TRestRawSignalEvent*> fEventPool;  //!
+    std::vector<TRestRawSignalEvent*> fFreeEvents;  //!
+    std::vector<Int_t> fPending;                    //!
+    std::vector<Bool_t> fExhausted;                 //!
+    std::vector<Bool_t> fContributing;              //!
+    Long64_t fSerial = 0;                           //!
+
+    void ClearSources();
+    void FillSource(Int_t source);
+    void ClearQueue();
+
+   protected:
+    void InitFromConfigFile() override;
+
+   public:
+    void Initialize() override;
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+    void EndProcess() override;
+    const char* GetProcessName() const override { return "MultiSourceToSignal"; }
+
+    void PrintMetadata() override;
+
+    Bool_t OpenInputFiles(const std::vector<std::string>& files) override;
+    Bool_t AddInputFile(const std::string& file) override;
+    Bool_t ResetEntry() override;
+
+    Long64_t GetTotalBytesRead() const override;
+
+    inline size_t GetNumberOfSources() const { return fSourceTypes.size(); }
+    inline Double_t GetCoincidenceWindow() const { return fCoincidenceWindow; }
+    inline Int_t GetBufferDepth() const { return fBufferDepth; }
+    inline Long64_t GetOrphanEvents() const { return fOrphanEvents; }
+
+    // Constructor
+    TRestRawMultiSourceToSignalProcess();
+    TRestRawMultiSourceToSignalProcess(const char* configFilename);
+    // Destructor
+    ~TRestRawMultiSourceToSignalProcess();
+
+    ClassDefOverride(TRestRawMultiSourceToSignalProcess, 1);
+};
+#endif
@@ -36,6 +36,8 @@ class TRestRawSignal : public TObject {
    private:
     void CalculateThresholdIntegral();
 
+    void ConstrainBaseLineRange(Int_t& startBin, Int_t& endBin) const;
+
     void CalculateBaseLineSigmaSD(Int_t startBin, Int_t endBin);
 
     void CalculateBaseLineSigmaIQR(Int_t startBin, Int_t endBin);
@@ -49,9 +51,30 @@ class TRestRawSignal : public TObject {
     /// Vector with the data of the signal
     std::vector<Short_t> fSignalData;
 
+    /// The data of the signal as floating point values. If not empty, it holds the signal values, and
+    /// fSignalData is left empty.
+    std::vector<Float_t> fFloatData;
+
+    /// The bin, in the original acquisition window, of the first data point. Non-zero for cropped signals.
+    Int_t fStartBin = 0;
+
     Bool_t fShowWarnings = true;
 
    public:
+    /// The parameters of one of the pulses identified by FindPulses
+    struct Pulse {
+        /// The first bin of the pulse
+        Int_t start;
+        /// The bin after the last bin of the pulse
+        Int_t end;
+        /// The bin where the pulse reaches its maximum
+        Int_t peakBin;
+        /// The maximum value of the pulse, baseline corrected
+        Double_t amplitude;
+        /// The sum of the pulse values, baseline corrected
+        Double_t integral;
+    };
+
     /// A TGraph pointer used to store the TRestRawSignal drawing
     TGraph* fGraph;  //!
 
@@ -83,7 +106,13 @@ class TRestRawSignal : public TObject {
     inline Int_t GetID() const { return fSignalID; }
 
     /// Returns the actual number of points, or size of the signal
-    inline Int_t GetNumberOfPoints() const { return fSignalData.size(); }
+    inline Int_t GetNumberOfPoints() const { return IsFloat() ? fFloatData.size() : fSignalData.size(); }
+
+    /// Returns the bin, in the original acquisition window, of the first data point
+    inline Int_t GetStartBin() const { return fStartBin; }
+
+    /// Returns true if the signal values are stored as floating point values
+    inline Bool_t IsFloat() const { return !fFloatData.empty(); }
 
     /// Returns a std::vector containing the indexes of data points over threshold
     inline std::vector<Int_t> GetPointsOverThreshold() const { return fPointsOverThreshold; }
@@ -135,6 +164,9 @@ class TRestRawSignal : public TObject {
     /// It sets the number of tail points
     inline void SetTailPoints(Int_t p) { fTailPoints = p; }
 
+    /// It sets the bin, in the original acquisition window, of the first data point
+    inline void SetStartBin(Int_t bin) { fStartBin = bin; }
+
     /// It sets/constrains the range for any calculation.
     inline void SetRange(const TVector2& range) { fRange = range; }
 
@@ -149,6 +181,20 @@ class TRestRawSignal : public TObject {
 
     void AddPoint(Short_t d);
 
+    void AddPoints(const Int_t* data, Int_t nPoints);
+
+    void AddRoundedPoint(Double_t d);
+
+    void AddFloatPoint(Float_t d);
+
+    void SetFloatData(const std::vector<Float_t>& data);
+
+    void GetFloatData(std::vector<Float_t>& data) const;
+
+    void ConvertToFloat();
+
+    void ConvertToShort();
+
     void AddCharge(Short_t d);
 
     void AddDeposit(Short_t d);
@@ -179,18 +225,38 @@ class TRestRawSignal : public TObject {
 
     Int_t GetMaxPeakBin();
 
+    Double_t GetMaxPeakTime(const std::string& option = "");
+
+    Double_t GetMaxPeakTime(Int_t bin, const std::string& option = "") const;
+
+    Double_t GetThresholdCrossingTime(Double_t threshold);
+
+    Double_t GetConstantFractionTime(Double_t fraction = 0.3, Int_t delay = 0);
+
     Double_t GetMinPeakValue();
 
     Int_t GetMinPeakBin();
 
     Bool_t IsADCSaturation(int Nflat = 3);
 
+    Int_t FindPulses(std::vector<Pulse>& pulses, Double_t hysteresis);
+
     void GetDifferentialSignal(TRestRawSignal* diffSignal, Int_t smearPoints);
 
     void GetSignalSmoothed(TRestRawSignal* smoothedSignal, Int_t averagingPoints);
 
     std::vector<Float_t> GetSignalSmoothed(Int_t averagingPoints, std::string option = "");
 
+    static const std::vector<Double_t>& GetSavitzkyGolayCoefficients(Int_t halfWindow, Int_t order,
+                                                                     Int_t derivative = 0);
+
+    void GetSignalSavitzkyGolay(std::vector<Float_t>& result, Int_t halfWindow, Int_t order,
+                                Int_t derivative = 0);
+
+    void GetSignalShifted(std::vector<Float_t>& result, Double_t shift, const std::string& option = "");
+
+    void GetSignalDecimated(std::vector<Float_t>& result, Int_t factor, const std::string& option = "");
+
     void GetWhiteNoiseSignal(TRestRawSignal* noiseSignal, Double_t noiseLevel = 1.);
 
     void CalculateBaseLineMean(Int_t startBin, Int_t endBin);
@@ -207,6 +273,12 @@ class TRestRawSignal : public TObject {
 
     void Scale(Double_t value);
 
+    void Calibrate(Double_t gain, Double_t offset);
+
+    Int_t RemoveSpikes(Double_t threshold, Int_t window = 3);
+
+    void Crop(Int_t from, Int_t to);
+
     void WriteSignalToTextFile(const TString& filename);
 
     void Print() const;
@@ -217,6 +289,6 @@ class TRestRawSignal : public TObject {
     TRestRawSignal(Int_t nBins);
     ~TRestRawSignal();
 
-    ClassDef(TRestRawSignal, 1);
+    ClassDef(TRestRawSignal, 3);
 };
 #endif
@@ -51,6 +51,19 @@ class TRestRawSignalAnalysisProcess : public TRestEventProcess {
     /// The minimum number of points over threshold to identify a signal as such
     Int_t fPointsOverThreshold = 5;
 
+    /// Hysteresis, in baseline sigmas, used to identify multiple pulses in a signal.
+    /// Disabled if not positive.
+    Double_t fPulseHysteresis = -1;
+
+    /// Amplitude fraction used to obtain the constant fraction time. Disabled if not positive.
+    Double_t fCFDFraction = -1;
+
+    /// Delay, in bins, of the constant fraction discriminator. If not positive, fraction of amplitude timing.
+    Int_t fCFDDelay = 0;
+
+    /// A buffer reused to identify the pulses of each signal
+    std::vector<TRestRawSignal::Pulse> fPulses;  //!
+
     /// It defines the signals id range where analysis is applied
     TVector2 fSignalsRange = TVector2(-1, -1);  //<
 
@@ -76,6 +89,11 @@ class TRestRawSignalAnalysisProcess : public TRestEventProcess {
         RESTMetadata << "Point Threshold : " << fPointThreshold << " sigmas" << RESTendl;
         RESTMetadata << "Signal threshold : " << fSignalThreshold << " sigmas" << RESTendl;
         RESTMetadata << "Number of points over threshold : " << fPointsOverThreshold << RESTendl;
+        if (fCFDFraction > 0)
+            RESTMetadata << "CFD fraction : " << fCFDFraction << " (delay : " << fCFDDelay << " bins)"
+                         << RESTendl;
+        if (fPulseHysteresis > 0)
+            RESTMetadata << "Pulse hysteresis : " << fPulseHysteresis << " sigmas" << RESTendl;
 
         EndPrintProcess();
     }
@@ -85,6 +103,6 @@ class TRestRawSignalAnalysisProcess : public TRestEventProcess {
     TRestRawSignalAnalysisProcess();   // Constructor
     ~TRestRawSignalAnalysisProcess();  // Destructor
 
-    ClassDefOverride(TRestRawSignalAnalysisProcess, 4);
+    ClassDefOverride(TRestRawSignalAnalysisProcess, 5);
 };
 #endif
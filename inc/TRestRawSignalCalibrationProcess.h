@@ -0,0 +1,84 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawSignalCalibrationProcess
+#define RestCore_TRestRawSignalCalibrationProcess
+
+#include <TRestRawSignalEvent.h>
+
+#include "TRestEventProcess.h"
+
+//! A process equalizing the gain and offset of each channel of the raw signals
+class TRestRawSignalCalibrationProcess : public TRestEventProcess {
+   private:
+    /// A pointer to the specific TRestRawSignalEvent input, which is modified in place
+    TRestRawSignalEvent* fSignalEvent;  //!
+
+    /// Just a flag to quickly determine if we have to apply the range filter
+    Bool_t fRangeEnabled = false;  //!
+
+    /// The gain and the offset of each DAQ id
+    std::vector<Double_t> fGains;    //!
+    std::vector<Double_t> fOffsets;  //!
+
+    void Initialize() override;
+
+    Bool_t LoadCalibration();
+
+   protected:
+    /// The file containing the gain and offset of each channel
+    TString fCalibrationFile = "";
+
+    /// The sample type of the output signals, float or short. If empty, the sample type is not modified.
+    TString fSampleType = "";
+
+    /// It defines the signals id range where the calibration is applied
+    TVector2 fSignalsRange = TVector2(-1, -1);
+
+   public:
+    inline TString GetCalibrationFile() const { return fCalibrationFile; }
+    inline void SetCalibrationFile(const TString& calibrationFile) { fCalibrationFile = calibrationFile; }
+
+    inline TString GetSampleType() const { return fSampleType; }
+    inline void SetSampleType(const TString& sampleType) { fSampleType = sampleType; }
+
+    any GetInputEvent() const override { return fSignalEvent; }
+    any GetOutputEvent() const override { return fSignalEvent; }
+
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+
+    void PrintMetadata() override;
+
+    /// Returns a new instance of this class
+    TRestEventProcess* Maker() { return new TRestRawSignalCalibrationProcess; }
+
+    /// Returns the name of this process
+    const char* GetProcessName() const override { return "rawSignalCalibration"; }
+
+    TRestRawSignalCalibrationProcess();
+    TRestRawSignalCalibrationProcess(const char* configFilename);
+    ~TRestRawSignalCalibrationProcess();
+
+    ClassDefOverride(TRestRawSignalCalibrationProcess, 2);
+};
+#endif
@@ -0,0 +1,126 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawSignalClusteringProcess
+#define RestCore_TRestRawSignalClusteringProcess
+
+#include <TRestRawSignalEvent.h>
+
+#ifdef REST_DetectorLib
+#include <TRestDetectorReadout.h>
+#endif
+
+#include "TRestEventProcess.h"
+
+//! A process grouping the active neighbour channels of the raw signal events into clusters
+class TRestRawSignalClusteringProcess : public TRestEventProcess {
+   private:
+    /// A pointer to the specific TRestRawSignalEvent input
+    TRestRawSignalEvent* fSignalEvent = nullptr;  //!
+
+#ifdef REST_DetectorLib
+    /// A pointer to the readout metadata information accessible to TRestRun
+    TRestDetectorReadout* fReadout = nullptr;  //!
+#endif
+
+    /// Just a flag to quickly determine if we have to apply the range filter
+    Bool_t fRangeEnabled = false;  //!
+
+    /// True if the neighbours are obtained from the readout definition
+    Bool_t fUseReadout = false;  //!
+
+    /// The position in fNeighbourIds of the first neighbour of each DAQ id
+    std::vector<Int_t> fNeighbourOffsets;  //!
+
+    /// The DAQ ids of the neighbours of each DAQ id, consecutively
+    std::vector<Int_t> fNeighbourIds;  //!
+
+    /// The index of the active signal with each DAQ id in the current event, or -1
+    std::vector<Int_t> fActiveIndex;  //!
+
+    /// The union-find parent, and the time range and charge, of each active signal
+    std::vector<Int_t> fParent;     //!
+    std::vector<Int_t> fStartTime;  //!
+    std::vector<Int_t> fEndTime;    //!
+    std::vector<Double_t> fCharge;  //!
+
+    /// The number of channels, and the charge, of each cluster in the last event processed
+    std::vector<Int_t> fClusterSizes;       //!
+    std::vector<Double_t> fClusterCharges;  //!
+
+    void Initialize() override;
+
+    void BuildNeighbourMap();
+
+    Int_t FindRoot(Int_t index);
+
+   protected:
+    /// The source of the neighbour definition: readout or daq
+    TString fNeighbours = "readout";
+
+    /// The maximum separation, in bins, between the points over threshold of two neighbour channels
+    Int_t fTimeTolerance = 0;
+
+    /// The range used to calculate the baseline of each signal
+    TVector2 fBaseLineRange = TVector2(10, 90);
+
+    /// The number of baseline sigmas a point must exceed to be over threshold
+    Double_t fPointThreshold = 3;
+
+    /// The number of baseline sigmas the integral of the points over threshold must exceed
+    Double_t fSignalThreshold = 5;
+
+    /// The minimum number of consecutive points over threshold
+    Int_t fPointsOverThreshold = 5;
+
+    /// It defines the signals id range where the clusters are searched
+    TVector2 fSignalsRange = TVector2(-1, -1);
+
+   public:
+    inline TString GetNeighbours() const { return fNeighbours; }
+    inline Int_t GetTimeTolerance() const { return fTimeTolerance; }
+    inline void SetTimeTolerance(Int_t timeTolerance) { fTimeTolerance = timeTolerance; }
+
+    inline const std::vector<Int_t>& GetClusterSizes() const { return fClusterSizes; }
+    inline const std::vector<Double_t>& GetClusterCharges() const { return fClusterCharges; }
+
+    any GetInputEvent() const override { return fSignalEvent; }
+    any GetOutputEvent() const override { return fSignalEvent; }
+
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+
+    void PrintMetadata() override;
+
+    /// Returns a new instance of this class
+    TRestEventProcess* Maker() { return new TRestRawSignalClusteringProcess; }
+
+    /// Returns the name of this process
+    const char* GetProcessName() const override { return "rawSignalClustering"; }
+
+    TRestRawSignalClusteringProcess();
+    TRestRawSignalClusteringProcess(const char* configFilename);
+    ~TRestRawSignalClusteringProcess();
+
+    ClassDefOverride(TRestRawSignalClusteringProcess, 1);
+};
+#endif
@@ -0,0 +1,98 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawSignalCrossTalkCorrectionProcess
+#define RestCore_TRestRawSignalCrossTalkCorrectionProcess
+
+#include <TRestRawSignalEvent.h>
+
+#include "TRestEventProcess.h"
+
+//! A process removing the cross-talk between channels using a sparse coupling matrix
+class TRestRawSignalCrossTalkCorrectionProcess : public TRestEventProcess {
+   private:
+    /// A pointer to the specific TRestRawSignalEvent input
+    TRestRawSignalEvent* fInputSignalEvent;  //!
+
+    /// A pointer to the specific TRestRawSignalEvent output
+    TRestRawSignalEvent* fOutputSignalEvent;  //!
+
+    /// Just a flag to quickly determine if we have to apply the range filter
+    Bool_t fRangeEnabled = false;  //!
+
+    /// The position at fTargetIds of the first coupling of each source DAQ id
+    std::vector<Int_t> fColumnOffsets;  //!
+
+    /// The target DAQ id and the coefficient of each coupling, grouped by source
+    std::vector<Int_t> fTargetIds;       //!
+    std::vector<Float_t> fCoefficients;  //!
+
+    /// The index of the signal with each DAQ id in the current event, or -1
+    std::vector<Int_t> fSignalIndex;  //!
+
+    /// The baseline corrected samples, and the cross-talk, of each signal, one after the other
+    std::vector<Float_t> fSamples;    //!
+    std::vector<Float_t> fCrossTalk;  //!
+    std::vector<size_t> fOffsets;     //!
+
+    void Initialize() override;
+
+    Bool_t LoadCouplingMatrix();
+
+   protected:
+    /// The file containing the coupling matrix
+    TString fCouplingFile = "";
+
+    /// The range used to calculate the baseline of each signal
+    TVector2 fBaseLineRange = TVector2(10, 90);
+
+    /// It defines the signals id range where the correction is applied
+    TVector2 fSignalsRange = TVector2(-1, -1);
+
+   public:
+    inline TString GetCouplingFile() const { return fCouplingFile; }
+    inline void SetCouplingFile(const TString& couplingFile) { fCouplingFile = couplingFile; }
+
+    /// Returns the number of non-zero coefficients of the coupling matrix
+    inline size_t GetNumberOfCouplings() const { return fCoefficients.size(); }
+
+    any GetInputEvent() const override { return fInputSignalEvent; }
+    any GetOutputEvent() const override { return fOutputSignalEvent; }
+
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+
+    void PrintMetadata() override;
+
+    /// Returns a new instance of this class
+    TRestEventProcess* Maker() { return new TRestRawSignalCrossTalkCorrectionProcess; }
+
+    /// Returns the name of this process
+    const char* GetProcessName() const override { return "rawSignalCrossTalkCorrection"; }
+
+    TRestRawSignalCrossTalkCorrectionProcess();
+    TRestRawSignalCrossTalkCorrectionProcess(const char* configFilename);
+    ~TRestRawSignalCrossTalkCorrectionProcess();
+
+    ClassDefOverride(TRestRawSignalCrossTalkCorrectionProcess, 1);
+};
+#endif
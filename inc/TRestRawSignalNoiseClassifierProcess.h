@@ -0,0 +1,129 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawSignalNoiseClassifierProcess
+#define RestCore_TRestRawSignalNoiseClassifierProcess
+
+#include <TRestRawSignalEvent.h>
+
+#include "TRestEventProcess.h"
+
+//! A process identifying the noise channels of the raw signal events with a pretrained classifier
+class TRestRawSignalNoiseClassifierProcess : public TRestEventProcess {
+   public:
+    /// The signal features evaluated by the classifier, in the order used at the model file
+    enum Feature { kMaxOverSigma = 0, kIntegral, kWidth, kMaxDerivative, kMinDerivative, kNFeatures };
+
+   private:
+    /// A pointer to the specific TRestRawSignalEvent input, which is modified in place
+    TRestRawSignalEvent* fSignalEvent;  //!
+
+    /// Just a flag to quickly determine if we have to apply the range filter
+    Bool_t fRangeEnabled = false;  //!
+
+    /// True if the noise signals are removed from the event
+    Bool_t fDropNoise = false;  //!
+
+    /// The bias and the feature weights of the linear model
+    std::vector<Double_t> fWeights;  //!
+
+    /// The first node of each decision tree
+    std::vector<Int_t> fTreeRoots;  //!
+
+    /// The nodes of all the decision trees. Leaves have a negative feature index.
+    std::vector<Int_t> fNodeFeature;       //!
+    std::vector<Double_t> fNodeThreshold;  //!
+    std::vector<Int_t> fNodeLeft;          //!
+    std::vector<Int_t> fNodeRight;         //!
+    std::vector<Double_t> fNodeValue;      //!
+
+    /// The features of the signals being classified, one row per feature
+    std::vector<Float_t> fFeatures;  //!
+
+    /// The classifier score of each signal being classified
+    std::vector<Double_t> fScores;  //!
+
+    /// The IDs of the signals classified as noise in the last event processed
+    std::vector<Int_t> fNoiseIds;  //!
+
+    void Initialize() override;
+
+    Bool_t LoadModel();
+
+    void EvaluateLinear(Int_t nSignals);
+    void EvaluateTrees(Int_t nSignals);
+
+   protected:
+    /// The file containing the classifier parameters
+    TString fModelFile = "";
+
+    /// The classifier type: linear or trees
+    TString fModelType = "linear";
+
+    /// The minimum score for a signal to be classified as a physical signal
+    Double_t fScoreThreshold = 0;
+
+    /// The action applied to the noise signals: tag or drop
+    TString fAction = "tag";
+
+    /// The range used to calculate the baseline of each signal
+    TVector2 fBaseLineRange = TVector2(10, 90);
+
+    /// The number of baseline sigmas a point must exceed to contribute to the width feature
+    Double_t fPointThreshold = 3;
+
+    /// It defines the signals id range where the signals are classified
+    TVector2 fSignalsRange = TVector2(-1, -1);
+
+   public:
+    inline TString GetModelFile() const { return fModelFile; }
+    inline void SetModelFile(const TString& modelFile) { fModelFile = modelFile; }
+
+    inline TString GetModelType() const { return fModelType; }
+    inline void SetModelType(const TString& modelType) { fModelType = modelType; }
+
+    inline TString GetAction() const { return fAction; }
+    inline void SetAction(const TString& action) { fAction = action; }
+
+    inline const std::vector<Int_t>& GetNoiseIds() const { return fNoiseIds; }
+
+    any GetInputEvent() const override { return fSignalEvent; }
+    any GetOutputEvent() const override { return fSignalEvent; }
+
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+
+    void PrintMetadata() override;
+
+    /// Returns a new instance of this class
+    TRestEventProcess* Maker() { return new TRestRawSignalNoiseClassifierProcess; }
+
+    /// Returns the name of this process
+    const char* GetProcessName() const override { return "rawSignalNoiseClassifier"; }
+
+    TRestRawSignalNoiseClassifierProcess();
+    TRestRawSignalNoiseClassifierProcess(const char* configFilename);
+    ~TRestRawSignalNoiseClassifierProcess();
+
+    ClassDefOverride(TRestRawSignalNoiseClassifierProcess, 1);
+};
+#endif
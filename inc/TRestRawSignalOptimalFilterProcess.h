@@ -0,0 +1,139 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawSignalOptimalFilterProcess
+#define RestCore_TRestRawSignalOptimalFilterProcess
+
+#include <TRestRawFFT.h>
+#include <TRestRawSignalEvent.h>
+
+#include "TRestEventProcess.h"
+
+//! A process estimating the pulse amplitude of each signal with the optimal (matched) filter
+class TRestRawSignalOptimalFilterProcess : public TRestEventProcess {
+   private:
+    /// A pointer to the specific TRestRawSignalEvent input
+    TRestRawSignalEvent* fSignalEvent;  //!
+
+    /// The FFT used to transform the signals, keeping the transform between events
+    TRestRawFFT fFFT;  //!
+
+    /// The number of samples of the template, and of the signals filtered
+    Int_t fNfft = 0;  //!
+
+    /// The bin where the template reaches its maximum
+    Int_t fTemplatePeakBin = 0;  //!
+
+    /// The real and imaginary parts of the template spectrum
+    std::vector<Double_t> fTemplateReal;  //!
+    std::vector<Double_t> fTemplateImg;   //!
+
+    /// The noise power spectrum of each channel used to calculate the weights
+    std::map<Int_t, std::vector<Double_t>> fNoisePower;  //!
+
+    /// The real and imaginary parts of the filter weights of each channel. The key -1 is used by default.
+    std::map<Int_t, std::vector<Double_t>> fWeightsReal;  //!
+    std::map<Int_t, std::vector<Double_t>> fWeightsImg;   //!
+
+    /// Just a flag to report only once the signals with a different number of samples
+    Bool_t fLengthWarning = false;  //!
+
+    /// The amplitude of each signal in the last event processed
+    std::map<Int_t, Double_t> fAmplitudes;  //!
+
+    /// The peak time of each signal in the last event processed, when searching in time
+    std::map<Int_t, Double_t> fTimes;  //!
+
+    void Initialize() override;
+
+    Bool_t LoadTemplate();
+
+    void LoadNoiseSpectra();
+
+    void CalculateWeights(Int_t channel, const std::vector<Double_t>& noisePower);
+
+   protected:
+    /// The ROOT file containing the pulse template
+    TString fTemplateFile = "";
+
+    /// The name of the TRestRawSignal, or TRestRawSignalTemplateBuilderProcess, inside the template file
+    TString fTemplateName = "signal Response";
+
+    /// A ROOT file produced by a previous run with this process, from which the noise spectra are taken
+    TString fNoiseFile = "";
+
+    /// If true, the amplitude is maximized with respect to the pulse time
+    Bool_t fTimeSearch = false;
+
+    /// The range used to calculate the baseline fluctuation of each signal
+    TVector2 fBaseLineRange = TVector2(10, 90);
+
+    /// Signals with amplitude below this number of baseline sigmas are used to estimate the noise
+    Double_t fNoiseThreshold = 4;
+
+    /// The noise power spectrum accumulated during the run for each channel
+    std::map<Int_t, std::vector<Double_t>> fNoiseSpectra;
+
+    /// The number of signals accumulated in the noise spectrum of each channel
+    std::map<Int_t, Int_t> fNoiseEntries;
+
+   public:
+    inline TString GetTemplateFile() const { return fTemplateFile; }
+    inline void SetTemplateFile(const TString& templateFile) { fTemplateFile = templateFile; }
+
+    inline TString GetTemplateName() const { return fTemplateName; }
+    inline void SetTemplateName(const TString& templateName) { fTemplateName = templateName; }
+
+    inline Bool_t GetTimeSearch() const { return fTimeSearch; }
+    inline void SetTimeSearch(Bool_t timeSearch) { fTimeSearch = timeSearch; }
+
+    inline const std::map<Int_t, Double_t>& GetAmplitudes() const { return fAmplitudes; }
+    inline const std::map<Int_t, Double_t>& GetTimes() const { return fTimes; }
+
+    /// It returns the noise power spectrum of a channel averaged over the signals used
+    std::vector<Double_t> GetNoiseSpectrum(Int_t channel) const;
+
+    inline const std::map<Int_t, std::vector<Double_t>>& GetNoiseSpectra() const { return fNoiseSpectra; }
+    inline const std::map<Int_t, Int_t>& GetNoiseEntries() const { return fNoiseEntries; }
+
+    any GetInputEvent() const override { return fSignalEvent; }
+    any GetOutputEvent() const override { return fSignalEvent; }
+
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+    void EndProcess() override;
+
+    void PrintMetadata() override;
+
+    /// Returns a new instance of this class
+    TRestEventProcess* Maker() { return new TRestRawSignalOptimalFilterProcess; }
+
+    /// Returns the name of this process
+    const char* GetProcessName() const override { return "rawSignalOptimalFilter"; }
+
+    TRestRawSignalOptimalFilterProcess();
+    TRestRawSignalOptimalFilterProcess(const char* configFilename);
+    ~TRestRawSignalOptimalFilterProcess();
+
+    ClassDefOverride(TRestRawSignalOptimalFilterProcess, 1);
+};
+#endif
@@ -0,0 +1,97 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawSignalROICropProcess
+#define RestCore_TRestRawSignalROICropProcess
+
+#include <TRestRawSignalEvent.h>
+
+#include "TRestEventProcess.h"
+
+//! A process cropping the raw signals to a region of interest around their pulses
+class TRestRawSignalROICropProcess : public TRestEventProcess {
+   private:
+    /// A pointer to the specific TRestRawSignalEvent input, which is modified in place
+    TRestRawSignalEvent* fSignalEvent;  //!
+
+    /// Just a flag to quickly determine if we have to apply the range filter
+    Bool_t fRangeEnabled = false;  //!
+
+    /// True if the region of interest is defined by the points over threshold
+    Bool_t fThresholdMode = false;  //!
+
+    void Initialize() override;
+
+   protected:
+    /// The definition of the region of interest: peak or threshold
+    TString fMode = "peak";
+
+    /// The number of points kept before the peak, or before the first point over threshold
+    Int_t fPreSamples = 64;
+
+    /// The number of points kept after the peak, or after the last point over threshold
+    Int_t fPostSamples = 128;
+
+    /// The range used to calculate the baseline in threshold mode
+    TVector2 fBaseLineRange = TVector2(10, 90);
+
+    /// The number of baseline sigmas a point must exceed to be over threshold
+    Double_t fPointThreshold = 3;
+
+    /// The number of baseline sigmas the integral of the points over threshold must exceed
+    Double_t fSignalThreshold = 5;
+
+    /// The minimum number of consecutive points over threshold
+    Int_t fPointsOverThreshold = 5;
+
+    /// If true, the signals without points over threshold are removed in threshold mode
+    Bool_t fRemoveEmptySignals = false;
+
+    /// It defines the signals id range where the signals are cropped
+    TVector2 fSignalsRange = TVector2(-1, -1);
+
+   public:
+    inline TString GetMode() const { return fMode; }
+    inline Int_t GetPreSamples() const { return fPreSamples; }
+    inline Int_t GetPostSamples() const { return fPostSamples; }
+
+    any GetInputEvent() const override { return fSignalEvent; }
+    any GetOutputEvent() const override { return fSignalEvent; }
+
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+
+    void PrintMetadata() override;
+
+    /// Returns a new instance of this class
+    TRestEventProcess* Maker() { return new TRestRawSignalROICropProcess; }
+
+    /// Returns the name of this process
+    const char* GetProcessName() const override { return "rawSignalROICrop"; }
+
+    TRestRawSignalROICropProcess();
+    TRestRawSignalROICropProcess(const char* configFilename);
+    ~TRestRawSignalROICropProcess();
+
+    ClassDefOverride(TRestRawSignalROICropProcess, 1);
+};
+#endif
@@ -0,0 +1,125 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawSignalRecursiveFilterProcess
+#define RestCore_TRestRawSignalRecursiveFilterProcess
+
+#include <TRestRawSignalEvent.h>
+
+#include "TRestEventProcess.h"
+
+//! A process applying recursive (IIR) CR-RC^n, pole-zero or trapezoidal shaping to the raw signals
+class TRestRawSignalRecursiveFilterProcess : public TRestEventProcess {
+   private:
+    /// A pointer to the specific TRestRawSignalEvent input
+    TRestRawSignalEvent* fInputSignalEvent;  //!
+
+    /// A pointer to the specific TRestRawSignalEvent output
+    TRestRawSignalEvent* fOutputSignalEvent;  //!
+
+    /// Just a flag to quickly determine if we have to apply the range filter
+    Bool_t fRangeEnabled = false;  //!
+
+    /// The differentiator coefficient of the CR stage
+    Double_t fCRCoefficient = 0;  //!
+
+    /// The integrator coefficient of the RC stages
+    Double_t fRCCoefficient = 0;  //!
+
+    /// The exponential decay factor per bin used for pole-zero and trapezoidal shaping
+    Double_t fDecayFactor = 0;  //!
+
+    /// The factor normalizing the filter response to unit amplitude
+    Double_t fNormalization = 1;  //!
+
+    /// The samples of the signals being filtered, one column per signal
+    std::vector<Float_t> fInput;  //!
+
+    /// The filtered samples, with the same layout as fInput
+    std::vector<Float_t> fOutput;  //!
+
+    /// The filter state of each signal being filtered
+    std::vector<Float_t> fState1;  //!
+    std::vector<Float_t> fState2;  //!
+
+    void Initialize() override;
+
+    void ApplyFilter(Int_t nSamples, Int_t nSignals);
+
+   protected:
+    /// The filter type: crrc, poleZero or trapezoidal
+    TString fFilterType = "crrc";
+
+    /// The time constant, in bins, of the CR and RC stages
+    Double_t fShapingTime = 10;
+
+    /// The number of RC integration stages of the CR-RC^n filter
+    Int_t fOrder = 4;
+
+    /// The exponential decay time, in bins, of the input pulses. If not positive, a step is assumed.
+    Double_t fDecayTime = -1;
+
+    /// The rise time, in bins, of the trapezoidal filter
+    Int_t fRiseTime = 10;
+
+    /// The flat top length, in bins, of the trapezoidal filter
+    Int_t fFlatTop = 5;
+
+    /// A value used to scale the output signal
+    Double_t fGain = 1;
+
+    /// The range used to calculate the baseline subtracted before filtering. Not used if (-1,-1).
+    TVector2 fBaseLineRange = TVector2(-1, -1);
+
+    /// It defines the signals id range where the filter is applied
+    TVector2 fSignalsRange = TVector2(-1, -1);
+
+   public:
+    inline TString GetFilterType() const { return fFilterType; }
+    inline Double_t GetShapingTime() const { return fShapingTime; }
+    inline Int_t GetOrder() const { return fOrder; }
+    inline Double_t GetDecayTime() const { return fDecayTime; }
+    inline Int_t GetRiseTime() const { return fRiseTime; }
+    inline Int_t GetFlatTop() const { return fFlatTop; }
+    inline Double_t GetGain() const { return fGain; }
+
+    any GetInputEvent() const override { return fInputSignalEvent; }
+    any GetOutputEvent() const override { return fOutputSignalEvent; }
+
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+
+    void PrintMetadata() override;
+
+    /// Returns a new instance of this class
+    TRestEventProcess* Maker() { return new TRestRawSignalRecursiveFilterProcess; }
+
+    /// Returns the name of this process
+    const char* GetProcessName() const override { return "rawSignalRecursiveFilter"; }
+
+    TRestRawSignalRecursiveFilterProcess();
+    TRestRawSignalRecursiveFilterProcess(const char* configFilename);
+    ~TRestRawSignalRecursiveFilterProcess();
+
+    ClassDefOverride(TRestRawSignalRecursiveFilterProcess, 1);
+};
+#endif
@@ -0,0 +1,78 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawSignalSpikeRemovalProcess
+#define RestCore_TRestRawSignalSpikeRemovalProcess
+
+#include <TRestRawSignalEvent.h>
+
+#include "TRestEventProcess.h"
+
+//! A process removing single point spikes, or glitches, from the raw signals using a median filter
+class TRestRawSignalSpikeRemovalProcess : public TRestEventProcess {
+   private:
+    /// A pointer to the specific TRestRawSignalEvent input, which is modified in place
+    TRestRawSignalEvent* fSignalEvent;  //!
+
+    /// Just a flag to quickly determine if we have to apply the range filter
+    Bool_t fRangeEnabled = false;  //!
+
+    void Initialize() override;
+
+   protected:
+    /// The number of points used for the median, 3 or 5
+    Int_t fWindow = 3;
+
+    /// The deviation from the median, in baseline sigmas, above which a point is replaced
+    Double_t fNSigmas = 5;
+
+    /// The range used to calculate the baseline fluctuation of each signal
+    TVector2 fBaseLineRange = TVector2(10, 90);
+
+    /// It defines the signals id range where the spikes are removed
+    TVector2 fSignalsRange = TVector2(-1, -1);
+
+   public:
+    inline Int_t GetWindow() const { return fWindow; }
+    inline Double_t GetNSigmas() const { return fNSigmas; }
+
+    any GetInputEvent() const override { return fSignalEvent; }
+    any GetOutputEvent() const override { return fSignalEvent; }
+
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+
+    void PrintMetadata() override;
+
+    /// Returns a new instance of this class
+    TRestEventProcess* Maker() { return new TRestRawSignalSpikeRemovalProcess; }
+
+    /// Returns the name of this process
+    const char* GetProcessName() const override { return "rawSignalSpikeRemoval"; }
+
+    TRestRawSignalSpikeRemovalProcess();
+    TRestRawSignalSpikeRemovalProcess(const char* configFilename);
+    ~TRestRawSignalSpikeRemovalProcess();
+
+    ClassDefOverride(TRestRawSignalSpikeRemovalProcess, 1);
+};
+#endif
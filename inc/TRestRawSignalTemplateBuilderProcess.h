@@ -0,0 +1,109 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawSignalTemplateBuilderProcess
+#define RestCore_TRestRawSignalTemplateBuilderProcess
+
+#include <TRestRawSignalEvent.h>
+
+#include "TRestEventProcess.h"
+#include "TRestRawThreadSums.h"
+
+//! A process building the average pulse template, per channel or global, from the signals of the run
+class TRestRawSignalTemplateBuilderProcess : public TRestEventProcess {
+   private:
+    /// A pointer to the specific TRestRawSignalEvent input
+    TRestRawSignalEvent* fSignalEvent;  //!
+
+    /// The sum of the aligned and normalized pulses of each template accumulated by this instance
+    std::map<Int_t, std::vector<Double_t>> fSums;  //!
+
+    /// The number of pulses contributing to each point of each template accumulated by this instance
+    std::map<Int_t, std::vector<Double_t>> fCounts;  //!
+
+    /// The number of pulses of each template accumulated by this instance
+    std::map<Int_t, Long64_t> fEntries;  //!
+
+    void Initialize() override;
+
+    void SetTemplates(const TRestRawThreadSums::Sums& sums);
+
+   protected:
+    /// Only the signals with amplitude inside this range, in ADC units, are used
+    TVector2 fAmplitudeRange = TVector2(400, 600);
+
+    /// The range used to calculate the baseline of each signal
+    TVector2 fBaseLineRange = TVector2(10, 90);
+
+    /// The method used to align the pulses: parabolic, gaussian, sinc or cfd
+    TString fAlignment = "parabolic";
+
+    /// The fraction of the amplitude used by the cfd alignment
+    Double_t fCFDFraction = 0.5;
+
+    /// The number of points of the template
+    Int_t fTemplateLength = 512;
+
+    /// The number of points of the template before the alignment time
+    Int_t fPreTrigger = 128;
+
+    /// If true, a template is built for each channel. Otherwise a global template is built.
+    Bool_t fPerChannel = false;
+
+    /// Events with more signals than this value are not used. Not used if negative.
+    Int_t fMaxSignals = -1;
+
+    /// The templates, normalized to unit amplitude, by signal id. The global template uses the id -1.
+    std::map<Int_t, std::vector<Float_t>> fTemplates;
+
+    /// The number of pulses averaged in each template
+    std::map<Int_t, Long64_t> fTemplateEntries;
+
+   public:
+    std::vector<Float_t> GetTemplate(Int_t channel = -1) const;
+
+    inline const std::map<Int_t, std::vector<Float_t>>& GetTemplates() const { return fTemplates; }
+    inline const std::map<Int_t, Long64_t>& GetTemplateEntries() const { return fTemplateEntries; }
+    inline Int_t GetPreTrigger() const { return fPreTrigger; }
+
+    any GetInputEvent() const override { return fSignalEvent; }
+    any GetOutputEvent() const override { return fSignalEvent; }
+
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+    void EndProcess() override;
+
+    void PrintMetadata() override;
+
+    /// Returns a new instance of this class
+    TRestEventProcess* Maker() { return new TRestRawSignalTemplateBuilderProcess; }
+
+    /// Returns the name of this process
+    const char* GetProcessName() const override { return "rawSignalTemplateBuilder"; }
+
+    TRestRawSignalTemplateBuilderProcess();
+    TRestRawSignalTemplateBuilderProcess(const char* configFilename);
+    ~TRestRawSignalTemplateBuilderProcess();
+
+    ClassDefOverride(TRestRawSignalTemplateBuilderProcess, 1);
+};
+#endif
@@ -0,0 +1,90 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawSignalToHitListProcess
+#define RestCore_TRestRawSignalToHitListProcess
+
+#include <TRestRawHitListEvent.h>
+#include <TRestRawSignalEvent.h>
+
+#include "TRestEventProcess.h"
+
+//! A process reducing the raw signals to a compact list of hits
+class TRestRawSignalToHitListProcess : public TRestEventProcess {
+   private:
+    /// A pointer to the specific TRestRawSignalEvent input
+    TRestRawSignalEvent* fInputSignalEvent;  //!
+
+    /// A pointer to the specific TRestRawHitListEvent output
+    TRestRawHitListEvent* fOutputHitListEvent;  //!
+
+    /// Just a flag to quickly determine if we have to apply the range filter
+    Bool_t fRangeEnabled = false;  //!
+
+    /// The pulses found at the signal being processed, reused to avoid allocations
+    std::vector<TRestRawSignal::Pulse> fPulses;  //!
+
+    void Initialize() override;
+
+   protected:
+    /// The range used to calculate the baseline of each signal
+    TVector2 fBaseLineRange = TVector2(10, 90);
+
+    /// The number of baseline sigmas a point must exceed to be over threshold
+    Double_t fPointThreshold = 3;
+
+    /// The number of baseline sigmas the integral of the points over threshold must exceed
+    Double_t fSignalThreshold = 5;
+
+    /// The minimum number of consecutive points over threshold
+    Int_t fPointsOverThreshold = 5;
+
+    /// The hysteresis, in baseline sigmas, used to split pile-up pulses. If not positive, one hit per signal.
+    Double_t fPulseHysteresis = -1;
+
+    /// It defines the signals id range where the hits are searched
+    TVector2 fSignalsRange = TVector2(-1, -1);
+
+   public:
+    inline Double_t GetPulseHysteresis() const { return fPulseHysteresis; }
+
+    any GetInputEvent() const override { return fInputSignalEvent; }
+    any GetOutputEvent() const override { return fOutputHitListEvent; }
+
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+
+    void PrintMetadata() override;
+
+    /// Returns a new instance of this class
+    TRestEventProcess* Maker() { return new TRestRawSignalToHitListProcess; }
+
+    /// Returns the name of this process
+    const char* GetProcessName() const override { return "rawSignalToHitList"; }
+
+    TRestRawSignalToHitListProcess();
+    TRestRawSignalToHitListProcess(const char* configFilename);
+    ~TRestRawSignalToHitListProcess();
+
+    ClassDefOverride(TRestRawSignalToHitListProcess, 1);
+};
+#endif
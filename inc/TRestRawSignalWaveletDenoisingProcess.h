@@ -0,0 +1,105 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawSignalWaveletDenoisingProcess
+#define RestCore_TRestRawSignalWaveletDenoisingProcess
+
+#include <TRestRawSignalEvent.h>
+
+#include "TRestEventProcess.h"
+
+//! A process reducing the noise of the raw signals by thresholding their wavelet coefficients
+class TRestRawSignalWaveletDenoisingProcess : public TRestEventProcess {
+   private:
+    /// A pointer to the specific TRestRawSignalEvent input
+    TRestRawSignalEvent* fInputSignalEvent;  //!
+
+    /// A pointer to the specific TRestRawSignalEvent output
+    TRestRawSignalEvent* fOutputSignalEvent;  //!
+
+    /// Just a flag to quickly determine if we have to apply the range filter
+    Bool_t fRangeEnabled = false;  //!
+
+    /// The samples of the signals being transformed, one column per signal
+    std::vector<Float_t> fCoefficients;  //!
+
+    /// The threshold of each signal being transformed, in ADC units per unit noise gain
+    std::vector<Float_t> fThresholds;  //!
+
+    /// The standard deviation of each wavelet coefficient for a unit white noise
+    std::vector<Float_t> fNoiseGain;  //!
+
+    /// The number of levels of the transform for the current number of samples
+    Int_t fNumberOfLevels = 0;  //!
+
+    void Initialize() override;
+
+    Int_t GetNumberOfLevels(Int_t nSamples) const;
+
+    void Transform(Int_t nSamples, Int_t nSignals, Bool_t inverse);
+
+    void CalculateNoiseGain(Int_t nSamples);
+
+    void ApplyThresholds(Int_t nSamples, Int_t nSignals);
+
+   protected:
+    /// The maximum number of levels of the wavelet decomposition
+    Int_t fLevels = 4;
+
+    /// The threshold type: soft or hard
+    TString fThresholdType = "soft";
+
+    /// The threshold applied to the wavelet coefficients, in number of baseline sigmas
+    Double_t fNSigmas = 3;
+
+    /// The range used to calculate the baseline fluctuation of each signal
+    TVector2 fBaseLineRange = TVector2(10, 90);
+
+    /// It defines the signals id range where the denoising is applied
+    TVector2 fSignalsRange = TVector2(-1, -1);
+
+   public:
+    inline Int_t GetLevels() const { return fLevels; }
+    inline TString GetThresholdType() const { return fThresholdType; }
+    inline Double_t GetNSigmas() const { return fNSigmas; }
+
+    any GetInputEvent() const override { return fInputSignalEvent; }
+    any GetOutputEvent() const override { return fOutputSignalEvent; }
+
+    void InitProcess() override;
+    TRestEvent* ProcessEvent(TRestEvent* inputEvent) override;
+
+    void PrintMetadata() override;
+
+    /// Returns a new instance of this class
+    TRestEventProcess* Maker() { return new TRestRawSignalWaveletDenoisingProcess; }
+
+    /// Returns the name of this process
+    const char* GetProcessName() const override { return "rawSignalWaveletDenoising"; }
+
+    TRestRawSignalWaveletDenoisingProcess();
+    TRestRawSignalWaveletDenoisingProcess(const char* configFilename);
+    ~TRestRawSignalWaveletDenoisingProcess();
+
+    ClassDefOverride(TRestRawSignalWaveletDenoisingProcess, 1);
+};
+#endif
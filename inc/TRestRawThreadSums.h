@@ -0,0 +1,48 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+#ifndef RestCore_TRestRawThreadSums
+#define RestCore_TRestRawThreadSums
+
+#include <Rtypes.h>
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+//! It merges the per-channel sums accumulated by the instances of a process running in different threads
+class TRestRawThreadSums {
+   public:
+    /// The sums of each channel, by name of the quantity summed
+    typedef std::map<std::string, std::map<Int_t, std::vector<Double_t>>> Sums;
+
+    /// The function placing the merged sums in an instance
+    typedef std::function<void(const Sums&)> Receiver;
+
+    static void Register(const std::string& name, const void* instance, const Receiver& receiver);
+
+    static Bool_t Merge(const std::string& name, const void* instance, const Sums& sums);
+
+    static void Unregister(const void* instance);
+};
+#endif
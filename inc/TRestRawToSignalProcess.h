@@ -26,6 +26,9 @@
 #include <TRestEventProcess.h>
 #include <TRestRawSignalEvent.h>
 
+#include <algorithm>
+#include <functional>
+
 //! A base class for any process reading a binary external file as input to REST
 class TRestRawToSignalProcess : public TRestEventProcess {
    protected:
@@ -53,8 +56,89 @@ class TRestRawToSignalProcess : public TRestEventProcess {
     bool fgKeepFileOpen;  //! true if need to open all raw files at the beginning
 
     Int_t fShowSamples;  //!
+
+    Long64_t SeekToPattern(FILE* f, const std::vector<UChar_t>& pattern, size_t matchSize,
+                           const std::function<bool(const UChar_t*)>& validate = nullptr,
+                           Long64_t maxSkip = -1);
 #endif
 
+    /// Accepted range for the event size in bytes as declared in the data headers. Disabled if (-1,-1).
+    TVector2 fEventSizeRange = TVector2(-1, -1);
+
+    /// Accepted range for the number of hit channels as declared in the data headers. Disabled if (-1,-1).
+    TVector2 fHitsRange = TVector2(-1, -1);
+
+    /// Accepted event (trigger) types as declared in the data headers. If empty all types are accepted.
+    std::vector<Int_t> fAcceptedEventTypes;
+
+    /// Number of data frames, or packets, decoded
+    Long64_t fNFrames = 0;
+
+    /// Number of corrupted or unrecognized frames found
+    Long64_t fNBadFrames = 0;
+
+    /// Number of events decoded and returned
+    Long64_t fNEvents = 0;
+
+    /// Number of events found without any signal
+    Long64_t fNEmptyEvents = 0;
+
+    /// Number of events rejected by the header pre-filter
+    Long64_t fPreFilterRejected = 0;
+
+    /// Number of bytes skipped while resynchronizing to the next valid frame
+    Long64_t fSkippedBytes = 0;
+
+    /// Time, in seconds, elapsed between the first and the last decoded event
+    Double_t fDecodingTime = 0;
+
+    /// Average number of decoded events per second
+    Double_t fEventRate = 0;
+
+    /// Average data throughput in MB/s
+    Double_t fDataRate = 0;
+
+    /// Time, in seconds, between two progress lines. Disabled if it is not positive.
+    Double_t fProgressInterval = 10;
+
+    Double_t fClockStart = -1;    //!
+    Double_t fLastProgress = -1;  //!
+
+    /// It must be called each time a data frame is decoded
+    inline void AddFrame() { fNFrames++; }
+
+    /// It must be called each time a corrupted frame is found
+    inline void AddBadFrame() { fNBadFrames++; }
+
+    void AddEvent();
+
+    void ResetStatistics();
+
+    void UpdateRates();
+
+    void CloseInputBinFile();
+
+    /// Returns true if the event size, in bytes, is inside fEventSizeRange
+    inline Bool_t AcceptEventSize(Long64_t size) const {
+        if (fEventSizeRange.X() >= 0 && size < fEventSizeRange.X()) return false;
+        if (fEventSizeRange.Y() >= 0 && size > fEventSizeRange.Y()) return false;
+        return true;
+    }
+
+    /// Returns true if the number of hit channels is inside fHitsRange
+    inline Bool_t AcceptHits(Int_t nHits) const {
+        if (fHitsRange.X() >= 0 && nHits < fHitsRange.X()) return false;
+        if (fHitsRange.Y() >= 0 && nHits > fHitsRange.Y()) return false;
+        return true;
+    }
+
+    /// Returns true if the event type is one of fAcceptedEventTypes
+    inline Bool_t AcceptEventType(Int_t type) const {
+        if (fAcceptedEventTypes.empty()) return true;
+        return std::find(fAcceptedEventTypes.begin(), fAcceptedEventTypes.end(), type) !=
+               fAcceptedEventTypes.end();
+    }
+
     void LoadDefaultConfig();
 
    public:
@@ -75,6 +159,10 @@ class TRestRawToSignalProcess : public TRestEventProcess {
 
     Bool_t ResetEntry() override;
 
+    void CloseInputFiles();
+
+    void EndProcess() override;
+
     Long64_t GetTotalBytesRead() const override { return totalBytesReaded; }
     Long64_t GetTotalBytes() const override { return totalBytes; }
     virtual std::string GetElectronicsType() const { return fElectronicsType; }
@@ -87,6 +175,6 @@ class TRestRawToSignalProcess : public TRestEventProcess {
     // Destructor
     ~TRestRawToSignalProcess();
 
-    ClassDefOverride(TRestRawToSignalProcess, 1);
+    ClassDefOverride(TRestRawToSignalProcess, 3);
 };
 #endif
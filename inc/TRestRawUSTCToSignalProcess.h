@@ -96,7 +96,6 @@ class TRestRawUSTCToSignalProcess : public TRestRawToSignalProcess {
     int fCurrentBuffer = 0;                                //!
     int fLastBufferedId = 0;                               //!
     std::vector<int> errorevents;                          //!
-    int unknownerrors = 0;                                 //!
 
     Long64_t fTimeOffset = 0;
     std::set<int> fChannelOffset;
@@ -23,6 +23,8 @@
 #ifndef RestCore_TRestRawVetoAnalysisProcess
 #define RestCore_TRestRawVetoAnalysisProcess
 
+#include <deque>
+
 #include "TRestEventProcess.h"
 #include "TRestRawSignalEvent.h"
 
@@ -66,6 +68,18 @@ class TRestRawVetoAnalysisProcess : public TRestEventProcess {
     Double_t fSignalThreshold;
     Int_t fPointsOverThreshold;
 
+    /// Time window, in seconds, to search for veto hits preceding the event time. Disabled if not positive.
+    Double_t fCoincidenceWindow = -1;
+
+    /// Sampling time, in seconds, used to add the veto peak time to the event time
+    Double_t fSamplingTime = 0;
+
+    /// Maximum number of veto hits kept for the coincidence search
+    Int_t fVetoHitsBufferSize = 4096;
+
+    /// Absolute times of the most recent veto hits, sorted in time
+    std::deque<Double_t> fVetoHitTimes;  //!
+
     void InitFromConfigFile() override;
 
     void Initialize() override;
@@ -84,6 +98,10 @@ class TRestRawVetoAnalysisProcess : public TRestEventProcess {
 
     void PrintMetadata() override;
 
+    void AddVetoHit(Double_t time);
+
+    Int_t CountVetoHits(Double_t since) const;
+
     /// Returns a new instance of this class
     TRestEventProcess* Maker() { return new TRestRawVetoAnalysisProcess; }
 
@@ -115,6 +133,6 @@ class TRestRawVetoAnalysisProcess : public TRestEventProcess {
 
     // If new members are added, removed or modified in this class version number
     // must be increased!
-    ClassDefOverride(TRestRawVetoAnalysisProcess, 2);
+    ClassDefOverride(TRestRawVetoAnalysisProcess, 3);
 };
 #endif
@@ -29,6 +29,25 @@
 /// **TODO**: This process might be obsolete today. It may need additional revision,
 /// validation, and documentation.
 ///
+/// ### CRC verification
+///
+/// The `DataPacketEnd` trailer of each data packet contains a 32-bit CRC,
+/// stored as two 16-bit words. When the `crcCheck` parameter is enabled the
+/// CRC-32 (IEEE 802.3 polynomial) of the packet, from the packet header to the
+/// last sample word, is computed and compared with the trailer. Packets with
+/// a wrong CRC are accounted as bad frames in the decoding statistics. If
+/// `dropBadCRC` is also enabled, events containing a bad packet are skipped.
+///
+/// The CRC is computed using a slicing-by-8 table implementation, so that
+/// the verification may stay enabled during production.
+///
+/// \code
+/// <TRestRawAFTERToSignalProcess name="daq" electronics="AFTER" >
+///     <parameter name="crcCheck" value="true" />
+///     <parameter name="dropBadCRC" value="false" />
+/// </TRestRawAFTERToSignalProcess>
+/// \endcode
+///
 /// <hr>
 ///
 /// \warning **⚠ REST is under continous development.** This documentation
@@ -51,6 +70,9 @@
 ///			  REST software.
 ///           Juanan Garcia
 ///
+/// 2026-October: Added optional data packet CRC verification. The samples of each
+///               packet are now read with a single fread call.
+///
 /// \class      TRestRawAFTERToSignalProcess
 /// \author     Juanan Garcia
 ///
@@ -71,8 +93,75 @@
 
 using namespace std;
 
+namespace {
+// Slicing-by-8 tables for the reflected CRC-32 (IEEE 802.3) polynomial
+struct CRC32Tables {
+    uint32_t table[8][256];
+
+    CRC32Tables() {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for (int k = 0; k < 8; k++) crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+            table[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; i++)
+            for (int t = 1; t < 8; t++)
+                table[t][i] = (table[t - 1][i] >> 8) ^ table[0][table[t - 1][i] & 0xFF];
+    }
+};
+
+const CRC32Tables& GetCRC32Tables() {
+    static const CRC32Tables tables;
+    return tables;
+}
+
+// It updates the (non-inverted) crc value with len bytes, processing 8 bytes per iteration
+uint32_t UpdateCRC32(uint32_t crc, const void* data, size_t len) {
+    const uint32_t(*T)[256] = GetCRC32Tables().table;
+    const unsigned char* p = (const unsigned char*)data;
+    while (len >= 8) {
+        uint32_t one =
+            crc ^ ((uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24);
+        uint32_t two = (uint32_t)p[4] | (uint32_t)p[5] << 8 | (uint32_t)p[6] << 16 | (uint32_t)p[7] << 24;
+        crc = T[7][one & 0xFF] ^ T[6][(one >> 8) & 0xFF] ^ T[5][(one >> 16) & 0xFF] ^ T[4][one >> 24] ^
+              T[3][two & 0xFF] ^ T[2][(two >> 8) & 0xFF] ^ T[1][(two >> 16) & 0xFF] ^ T[0][two >> 24];
+        p += 8;
+        len -= 8;
+    }
+    while (len--) crc = (crc >> 8) ^ T[0][(crc ^ *p++) & 0xFF];
+    return crc;
+}
+}  // namespace
+
 ClassImp(TRestRawAFTERToSignalProcess);
 
+///////////////////////////////////////////////
+/// \brief It returns the CRC-32 (IEEE 802.3) of len bytes
+///
+uint32_t TRestRawAFTERToSignalProcess::CalculateCRC32(const void* data, size_t len) {
+    return UpdateCRC32(0xFFFFFFFF, data, len) ^ 0xFFFFFFFF;
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the CRC-32 of a data packet, from the packet header to the
+/// last data word, as stored in the file (big endian)
+///
+uint32_t TRestRawAFTERToSignalProcess::GetPacketCRC(const DataPacketHeader& header, const uint16_t* data,
+                                                    size_t nWords) {
+    uint32_t crc = UpdateCRC32(0xFFFFFFFF, &header, sizeof(DataPacketHeader));
+    return UpdateCRC32(crc, data, nWords * sizeof(uint16_t)) ^ 0xFFFFFFFF;
+}
+
+///////////////////////////////////////////////
+/// \brief It returns true if the CRC of the data packet matches the crc1 (high
+/// word) and crc2 (low word) values of its DataPacketEnd trailer
+///
+Bool_t TRestRawAFTERToSignalProcess::CheckPacketCRC(const DataPacketHeader& header, const uint16_t* data,
+                                                    size_t nWords, const DataPacketEnd& end) {
+    uint32_t expected = ((uint32_t)ntohs(end.crc1) << 16) | ntohs(end.crc2);
+    return GetPacketCRC(header, data, nWords) == expected;
+}
+
 ///////////////////////////////////////////////
 /// \brief Default constructor
 ///
@@ -106,10 +195,24 @@ TRestRawAFTERToSignalProcess::~TRestRawAFTERToSignalProcess() {}
 void TRestRawAFTERToSignalProcess::Initialize() {
     TRestRawToSignalProcess::Initialize();
 
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
     prevTime = 0;
     reducedTime = 0;
 }
 
+///////////////////////////////////////////////
+/// \brief It reads the common TRestRawToSignalProcess parameters and the CRC
+/// verification options.
+///
+void TRestRawAFTERToSignalProcess::InitFromConfigFile() {
+    TRestRawToSignalProcess::InitFromConfigFile();
+
+    fCRCCheck = StringToBool(GetParameter("crcCheck", "false"));
+    fDropBadCRC = StringToBool(GetParameter("dropBadCRC", "false"));
+}
+
 ///////////////////////////////////////////////
 /// \brief Process initialization.
 ///
@@ -136,24 +239,42 @@ void TRestRawAFTERToSignalProcess::InitProcess() {
     tStart = tS.AsDouble();
     cout << tStart << endl;
     // Timestamp of the run
+
+    ResetStatistics();
 }
 
 ///////////////////////////////////////////////
 /// \brief The main processing event function
 ///
+/// Events with a bad CRC are skipped when `dropBadCRC` is enabled.
+///
 TRestEvent* TRestRawAFTERToSignalProcess::ProcessEvent(TRestEvent* inputEvent) {
+    do {
+        if (!ReadEvent()) return nullptr;
+    } while (fDropBadCRC && fEventBadCRC);
+
+    AddEvent();
+    return fSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief It reads the next event from the binary file into fSignalEvent. It
+/// returns false if the end of file is reached.
+///
+Bool_t TRestRawAFTERToSignalProcess::ReadEvent() {
     EventHeader head;
     DataPacketHeader pHeader;
     DataPacketEnd pEnd;
 
     fSignalEvent->Initialize();
+    fEventBadCRC = false;
 
     // Read next header or quit of end of file
     if (fread(&head, sizeof(EventHeader), 1, fInputBinFile) != 1) {
-        fclose(fInputBinFile);
+        CloseInputBinFile();
         cout << "Error reading event header :-(" << endl;
         cout << "... or end of file found :-)" << endl;
-        return nullptr;
+        return false;
     }
 
     head.eventSize = ntohl(head.eventSize);
@@ -179,7 +300,7 @@ TRestEvent* TRestRawAFTERToSignalProcess::ProcessEvent(TRestEvent* inputEvent) {
     uint32_t eventTime, deltaTime;
     uint32_t th, tl;
     int tempAsic1, tempAsic2, sampleCountRead, pay;
-    uint16_t data, dat;
+    uint16_t data;
 
     bool isData = false;
 
@@ -298,16 +419,24 @@ TRestEvent* TRestRawAFTERToSignalProcess::ProcessEvent(TRestEvent* inputEvent) {
         timeBin = 0;
 
         if (sampleCountRead < 9) isData = false;
-        for (int i = 0; i < sampleCountRead; i++) {
-            int y = fread(&dat, sizeof(uint16_t), 1, fInputBinFile);
-            if (y == 0)
+
+        // The samples, and the padding word if any, are read at once
+        fPacketData.resize(sampleCountRead + pay);
+        if (!fPacketData.empty()) {
+            size_t y = fread(fPacketData.data(), sizeof(uint16_t), fPacketData.size(), fInputBinFile);
+            if (y != fPacketData.size())
                 RESTError << "TRestRawAFTERToSignalProcess::ProcessEvent. Problems reading input file."
                           << RESTendl;
-            frameBits += sizeof(dat);
-            data = ntohs(dat);
+        }
+        frameBits += fPacketData.size() * sizeof(uint16_t);
 
-            std::bitset<16> bs(data);
-            RESTDebug << bs << RESTendl;
+        for (int i = 0; i < sampleCountRead; i++) {
+            data = ntohs(fPacketData[i]);
+
+            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug) {
+                std::bitset<16> bs(data);
+                RESTDebug << bs << RESTendl;
+            }
 
             if (((data & 0xFE00) >> 9) == 8) {
                 timeBin = GET_CELL_INDEX(data);
@@ -321,19 +450,22 @@ TRestEvent* TRestRawAFTERToSignalProcess::ProcessEvent(TRestEvent* inputEvent) {
         }
 
         RESTDebug << pay << RESTendl;
-        if (pay) {
-            int z = fread(&dat, sizeof(uint16_t), 1, fInputBinFile);
-            if (z == 0)
-                RESTError << "TRestRawAFTERToSignalProcess::ProcessEvent. Problems reading input file."
-                          << RESTendl;
-            frameBits += sizeof(uint16_t);
-        }
 
         int w = fread(&pEnd, sizeof(DataPacketEnd), 1, fInputBinFile);
         if (w == 0)
             RESTError << "TRestRawAFTERToSignalProcess::ProcessEvent. Problems reading input file."
                       << RESTendl;
         frameBits += sizeof(DataPacketEnd);
+        AddFrame();
+
+        if (fCRCCheck && !CheckPacketCRC(pHeader, fPacketData.data(), fPacketData.size(), pEnd)) {
+            AddBadFrame();
+            fEventBadCRC = true;
+            RESTDebug << "Event " << head.eventNumb << " : wrong CRC 0x" << std::hex
+                      << GetPacketCRC(pHeader, fPacketData.data(), fPacketData.size()) << " (expected 0x"
+                      << (((uint32_t)ntohs(pEnd.crc1) << 16) | ntohs(pEnd.crc2)) << ")" << std::dec
+                      << RESTendl;
+        }
 
         RESTDebug << "Read "
                   << sampleCountRead * sizeof(uint16_t) + sizeof(DataPacketHeader) + sizeof(DataPacketEnd) +
@@ -353,5 +485,5 @@ TRestEvent* TRestRawAFTERToSignalProcess::ProcessEvent(TRestEvent* inputEvent) {
 
     RESTDebug << "End of event " << RESTendl;
 
-    return fSignalEvent;
+    return true;
 }
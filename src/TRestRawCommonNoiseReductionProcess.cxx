@@ -49,6 +49,12 @@
 ///
 /// Output signal without base line subtraction.
 ///
+/// The values of the signals at each time bin are gathered contiguously, and
+/// only the central ranks are selected (std::nth_element), instead of sorting
+/// them completely. The selection is specialized at compile time for the
+/// number of channels of the AGET chips (68, 72 or 80), which is the usual
+/// size of a block.
+///
 /// <hr>
 ///
 /// \warning **⚠ REST is under continous development.** This
@@ -77,6 +83,8 @@
 /// 2020-October: Base line not subtracted.
 ///            David Diez
 ///
+/// 2026-October: Central ranks selection specialized for the AGET chip sizes.
+///
 /// \class      TRestRawCommonNoiseReductionProcess
 /// \author     Benjamin Manier
 /// \author     David Diez
@@ -89,10 +97,72 @@ using namespace std;
 
 #include <algorithm>
 #include <iostream>
+#include <type_traits>
 #include <vector>
 
+namespace {
+/// It calls kernel(n), where n is given as a compile time constant when it is the number of channels of
+/// an AGET chip (68, 72 or 80), and as a runtime value otherwise
+template <typename Kernel>
+inline auto WithChipChannels(Int_t n, Kernel&& kernel) {
+    switch (n) {
+        case 68:
+            return kernel(std::integral_constant<Int_t, 68>());
+        case 72:
+            return kernel(std::integral_constant<Int_t, 72>());
+        case 80:
+            return kernel(std::integral_constant<Int_t, 80>());
+        default:
+            return kernel(n);
+    }
+}
+
+/// The sum of the values with ranks from begin to end, among the n values given. Only those ranks are
+/// selected, and the values are reordered.
+template <typename Count>
+inline Double_t CentralRanksSum(Double_t* values, Count n, Int_t begin, Int_t end) {
+    std::nth_element(values, values + begin, values + n);
+    if (end > begin) std::nth_element(values + begin + 1, values + end, values + n);
+
+    Double_t sum = 0;
+    for (int i = begin; i <= end; i++) sum += values[i];
+    return sum;
+}
+}  // namespace
+
 ClassImp(TRestRawCommonNoiseReductionProcess);
 
+///////////////////////////////////////////////
+/// \brief It calculates the common noise correction of each bin, from the values
+/// of the n signals at fBinValues, stored contiguously for each bin.
+///
+/// For mode 0 the central value is taken, and for mode 1 the average of the
+/// *centerWidth%* values around the center.
+///
+void TRestRawCommonNoiseReductionProcess::CalculateCorrections(Int_t n, Int_t nBins, Double_t baseLine) {
+    Int_t begin = 0, end = 0;
+    Double_t norm = 1.0;
+
+    if (fMode == 0) {
+        // We take only the middle one
+        begin = n / 2;
+        end = begin;
+    } else if (fMode == 1) {
+        // We take the average of the TRestDetectorSignals at the Center
+        begin = n / 2 - (Int_t)(n * fCenterWidth * 0.01);
+        end = n / 2 + (Int_t)(n * fCenterWidth * 0.01);
+        norm = (Double_t)end - begin;
+    }
+
+    fCorrections.resize(nBins);
+    WithChipChannels(n, [&](auto count) {
+        for (Int_t bin = 0; bin < nBins; bin++) {
+            Double_t* values = &fBinValues[(size_t)bin * n];
+            fCorrections[bin] = baseLine - CentralRanksSum(values, count, begin, end) / norm;
+        }
+    });
+}
+
 ///////////////////////////////////////////////
 /// \brief Default constructor
 ///
@@ -193,41 +263,20 @@ TRestEvent* TRestRawCommonNoiseReductionProcess::ProcessEvent(TRestEvent* inputE
         }
 
         Int_t nBins = fInputEvent->GetSignal(0)->GetNumberOfPoints();
-        vector<Double_t> sgnlValues(N, 0.0);
-
-        for (Int_t bin = 0; bin < nBins; bin++) {
-            for (Int_t sgnl = 0; sgnl < N; sgnl++) {
-                sgnlValues[sgnl] = fOutputEvent->GetSignal(sgnl)->GetRawData(bin);
-            }
 
-            std::sort(sgnlValues.begin(), sgnlValues.end());
-
-            // Sorting the different methods
-            Int_t begin = 0, middle = 0, end = 0;
-            middle = (Int_t)N / 2;
-            Double_t norm = 1.0;
-
-            if (fMode == 0) {
-                // We take only the middle one
-                begin = (Int_t)((double_t)N / 2.0);
-                end = begin;
-                norm = 1.;
-            } else if (fMode == 1) {
-                // We take the average of the TRestDetectorSignals at the Center
-                begin = middle - (Int_t)(N * fCenterWidth * 0.01);
-                end = middle + (Int_t)(N * fCenterWidth * 0.01);
-                norm = (Double_t)end - begin;
-            }
-
-            // Calculation of the correction to be made to each TRestRawSignal
-            Double_t binCorrection = 0.0;
-            for (Int_t i = begin; i <= end; i++) binCorrection += sgnlValues[i];
+        fBinValues.resize((size_t)nBins * N);
+        for (Int_t sgnl = 0; sgnl < N; sgnl++) {
+            const TRestRawSignal* signal = fOutputEvent->GetSignal(sgnl);
+            for (Int_t bin = 0; bin < nBins; bin++)
+                fBinValues[(size_t)bin * N + sgnl] = signal->GetRawData(bin);
+        }
 
-            binCorrection = binCorrection / norm;
+        CalculateCorrections(N, nBins, Baseline);
 
-            // Correction applied.
-            for (Int_t sgnl = 0; sgnl < N; sgnl++)
-                fOutputEvent->GetSignal(sgnl)->IncreaseBinBy(bin, Baseline - binCorrection);
+        // Correction applied.
+        for (Int_t sgnl = 0; sgnl < N; sgnl++) {
+            TRestRawSignal* signal = fOutputEvent->GetSignal(sgnl);
+            for (Int_t bin = 0; bin < nBins; bin++) signal->IncreaseBinBy(bin, fCorrections[bin]);
         }
 
         return fOutputEvent;
@@ -259,55 +308,29 @@ TRestEvent* TRestRawCommonNoiseReductionProcess::ProcessEvent(TRestEvent* inputE
             }
 
             Int_t nBins = fInputEvent->GetSignal(0)->GetNumberOfPoints();
-            vector<Double_t> sgnlValues(nSign, 0.0);
 
             // debug << "nSign: " << nSign << endl;
 
-            for (Int_t bin = 0; bin < nBins; bin++) {
+            if (nSign > 0) {
+                fBinValues.resize((size_t)nBins * nSign);
                 int i = 0;
                 for (Int_t sgnl = 0; sgnl < N; sgnl++) {
                     sigID = firstInBlock + sgnl;
                     if (fInputEvent->GetSignalById(sigID)->GetBaseLineSigma() >= 3.3) {
-                        // debug << "Baseline2: " <<
-                        // fInputEvent->GetSignalById(sigID)->GetBaseLineSigma() <<
-                        // endl;
-                        // debug << fOutputEvent->GetSignalById(sigID)->GetRawData(bin) <<
-                        // endl;
-                        sgnlValues[i] = fOutputEvent->GetSignalById(sigID)->GetRawData(bin);
+                        const TRestRawSignal* signal = fOutputEvent->GetSignalById(sigID);
+                        for (Int_t bin = 0; bin < nBins; bin++)
+                            fBinValues[(size_t)bin * nSign + i] = signal->GetRawData(bin);
                         i++;
                     }
                 }
 
-                std::sort(sgnlValues.begin(), sgnlValues.end());
-
-                // Sorting the different methods
-                Int_t begin = 0, middle = 0, end = 0;
-                middle = (Int_t)nSign / 2;
-                Double_t norm = 1.0;
-
-                if (fMode == 0) {
-                    // We take only the middle one
-                    begin = (Int_t)((double_t)nSign / 2.0);
-                    end = begin;
-                    norm = 1.;
-                } else if (fMode == 1) {
-                    // We take the average of the TRestDetectorSignals at the Center
-                    begin = middle - (Int_t)(nSign * fCenterWidth * 0.01);
-                    end = middle + (Int_t)(nSign * fCenterWidth * 0.01);
-                    norm = (Double_t)end - begin;
-                }
-
-                // Calculation of the correction to be made to each TRestRawSignal
-                Double_t binCorrection = 0.0;
-                for (Int_t i = begin; i <= end; i++) binCorrection += sgnlValues[i];
-
-                binCorrection = binCorrection / norm;
+                CalculateCorrections(nSign, nBins, Baseline);
 
                 // Correction applied.
                 for (Int_t sgnl = 0; sgnl < N; sgnl++) {
                     if (fInputEvent->GetSignalById(firstInBlock + sgnl)->GetBaseLineSigma() >= 3.3) {
-                        fOutputEvent->GetSignalById(firstInBlock + sgnl)
-                            ->IncreaseBinBy(bin, Baseline - binCorrection);
+                        TRestRawSignal* signal = fOutputEvent->GetSignalById(firstInBlock + sgnl);
+                        for (Int_t bin = 0; bin < nBins; bin++) signal->IncreaseBinBy(bin, fCorrections[bin]);
                     }
                 }
             }
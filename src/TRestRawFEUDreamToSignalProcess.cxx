@@ -62,6 +62,9 @@
 // 2021-May: Readapted to compile in REST v2.3.X
 //           Damien Neyret
 //
+// 2026-October: Bad events and progress are accounted in the common decoding
+//               statistics of TRestRawToSignalProcess
+//
 // \class      TRestRawFEUDreamToSignalProcess
 // \author     Damien Neyret
 // \author     Javier Galan
@@ -92,8 +95,7 @@ void TRestRawFEUDreamToSignalProcess::Initialize() {
 
     // MaxThreshold = 4000;
     bad_event = false;
-    line = 0;                   // line number
-    Nevent = 0, Nbadevent = 0;  // current event number
+    line = 0;  // line number
     IDEvent = 0;
 }
 
@@ -102,6 +104,7 @@ void TRestRawFEUDreamToSignalProcess::InitProcess() {
     RESTInfo << "TRestRawFEUDreamToSignalProcess::InitProcess" << RESTendl;
 
     totalBytesReaded = 0;
+    ResetStatistics();
 }
 
 TRestEvent* TRestRawFEUDreamToSignalProcess::ProcessEvent(TRestEvent* inputEvent) {
@@ -147,16 +150,11 @@ TRestEvent* TRestRawFEUDreamToSignalProcess::ProcessEvent(TRestEvent* inputEvent
                   << RESTendl;
         if (badreadfg) {
             RESTError << "TRestRawFEUDreamToSignalProcess::ProcessEvent: Error in event reading at event "
-                      << Nevent << RESTendl;
+                      << fNEvents << RESTendl;
             break;
         }
 
-        Nevent++;
-        if (badreadfg) break;  // break from loop
-        if (bad_event) Nbadevent++;
-        if ((Nevent % 100) == 0)
-            cout << "TRestRawFEUDreamToSignalProcess::ProcessEvent: " << Nevent
-                 << " events processed in file, and " << Nbadevent << " bad events skipped " << endl;
+        if (bad_event) AddBadFrame();
 
         if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Info) {
             RESTInfo << "-- TRestRawFEUDreamToSignalProcess::ProcessEvent ---" << RESTendl;
@@ -180,6 +178,7 @@ TRestEvent* TRestRawFEUDreamToSignalProcess::ProcessEvent(TRestEvent* inputEvent
         RESTDebug << "TRestRawFEUDreamToSignalProcess::ProcessEvent: returning signal event fSignalEvent "
                   << fSignalEvent << RESTendl;
         if (GetVerboseLevel() > TRestStringOutput::REST_Verbose_Level::REST_Debug) fSignalEvent->PrintEvent();
+        AddEvent();
         return fSignalEvent;
     }
 
@@ -354,7 +353,7 @@ bool TRestRawFEUDreamToSignalProcess::ReadDreamData(FeuReadOut& Feu) {
                          "ferror "
                       << ferror(fInputBinFile) << " feof " << feof(fInputBinFile) << " fInputBinFile "
                       << fInputBinFile << RESTendl;
-            fclose(fInputBinFile);
+            CloseInputBinFile();
             return true;  // failed
         }
         // debug<<" Reading DreamData ok, nbytes "<<nbytes<<endl;
@@ -565,7 +564,7 @@ bool TRestRawFEUDreamToSignalProcess::ReadFeuTrailer(FeuReadOut& Feu) {
                 << "TRestRawFEUDreamToSignalProcess::ReadFeuTrailer: can't read new data from file, ferror "
                 << ferror(fInputBinFile) << " feof " << feof(fInputBinFile) << " fInputBinFile "
                 << fInputBinFile << RESTendl;
-            fclose(fInputBinFile);
+            CloseInputBinFile();
             return true;  // failed
         }
         RESTDebug << "TRestRawFEUDreamToSignalProcess::ReadFeuTrailer: Reading FeuTrailer ok, nbytes "
@@ -13,6 +13,9 @@
 ///                 Created as part of the conceptualization of existing REST
 ///                 software.
 ///                 Javier Galan
+///
+///             oct 2026:   The transforms are created once for each size
+///                 and reused by the following calls.
 ///_______________________________________________________________________________
 
 #include "TRestRawFFT.h"
@@ -28,8 +31,51 @@ TRestRawFFT::TRestRawFFT() {
     // TRestRawFFT default constructor
 }
 
+TRestRawFFT::TRestRawFFT(const TRestRawFFT& fft)
+    : TObject(fft),
+      fNfft(fft.fNfft),
+      fTimeReal(fft.fTimeReal),
+      fTimeImg(fft.fTimeImg),
+      fFrequencyReal(fft.fFrequencyReal),
+      fFrequencyImg(fft.fFrequencyImg) {
+    // TRestRawFFT copy constructor. The copy creates its own transforms when needed.
+}
+
+TRestRawFFT& TRestRawFFT::operator=(const TRestRawFFT& fft) {
+    // TRestRawFFT assignment. The cached transforms are released, since they might not match the new size.
+    if (this == &fft) return *this;
+
+    TObject::operator=(fft);
+    fNfft = fft.fNfft;
+    fTimeReal = fft.fTimeReal;
+    fTimeImg = fft.fTimeImg;
+    fFrequencyReal = fft.fFrequencyReal;
+    fFrequencyImg = fft.fFrequencyImg;
+
+    delete fForwardFFT;
+    delete fBackwardFFT;
+    fForwardFFT = nullptr;
+    fBackwardFFT = nullptr;
+
+    return *this;
+}
+
 TRestRawFFT::~TRestRawFFT() {
     // TRestRawFFT destructor
+    delete fForwardFFT;
+    delete fBackwardFFT;
+}
+
+TVirtualFFT* TRestRawFFT::GetTransform(TVirtualFFT*& fft, const char* option) {
+    // It returns the cached transform, which is created again only when the size changes.
+    // TVirtualFFT keeps a reference to the last transform created, and it could reuse or delete
+    // it on the next call to TVirtualFFT::FFT, so that reference is released.
+    if (fft == nullptr || fft->GetN()[0] != fNfft) {
+        delete fft;
+        fft = TVirtualFFT::FFT(1, &fNfft, option);
+        TVirtualFFT::SetTransform(nullptr);
+    }
+    return fft;
 }
 
 void TRestRawFFT::SetNfft(Int_t n) {
@@ -57,18 +103,16 @@ void TRestRawFFT::ForwardSignalFFT(TRestRawSignal* sgnl, Int_t fNStart, Int_t fN
         fTimeImg[i - fNStart] = 0;
     }
 
-    TVirtualFFT* forward = TVirtualFFT::FFT(1, &fNfft, "R2C");
+    TVirtualFFT* forward = GetTransform(fForwardFFT, "R2C");
     forward->SetPointsComplex(fTimeReal.GetArray(), fTimeImg.GetArray());
     forward->Transform();
 
     for (int i = 0; i < fNfft; i++)
         forward->GetPointComplex(i, fFrequencyReal.GetArray()[i], fFrequencyImg.GetArray()[i]);
-
-    delete forward;
 }
 
 void TRestRawFFT::BackwardFFT() {
-    TVirtualFFT* backward = TVirtualFFT::FFT(1, &fNfft, "C2R");
+    TVirtualFFT* backward = GetTransform(fBackwardFFT, "C2R");
     backward->SetPointsComplex(fFrequencyReal.GetArray(), fFrequencyImg.GetArray());
     backward->Transform();
 
@@ -77,8 +121,6 @@ void TRestRawFFT::BackwardFFT() {
         fTimeReal.GetArray()[i] /= fNfft;
         fTimeImg.GetArray()[i] /= fNfft;
     }
-
-    delete backward;
 }
 
 void TRestRawFFT::ProduceDelta(Int_t t_o, Int_t Nfft) {
@@ -91,14 +133,12 @@ void TRestRawFFT::ProduceDelta(Int_t t_o, Int_t Nfft) {
         if (i == t_o) fTimeReal[i] = 1;
     }
 
-    TVirtualFFT* forward = TVirtualFFT::FFT(1, &fNfft, "R2C");
+    TVirtualFFT* forward = GetTransform(fForwardFFT, "R2C");
     forward->SetPointsComplex(fTimeReal.GetArray(), fTimeImg.GetArray());
     forward->Transform();
 
     for (int i = 0; i < fNfft; i++)
         forward->GetPointComplex(i, fFrequencyReal.GetArray()[i], fFrequencyImg.GetArray()[i]);
-
-    delete forward;
 }
 
 void TRestRawFFT::GetSignal(TRestRawSignal* sgnl) {
@@ -34,6 +34,9 @@
 /// validate and/or document this process. If all those points are addressed
 /// these lines can be removed.
 ///
+/// The average response signal is now built during the event processing by
+/// TRestRawSignalTemplateBuilderProcess, which should be used instead.
+///
 /// <hr>
 ///
 /// \warning **⚠ REST is under continous development.** This
@@ -0,0 +1,194 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawHitListEvent is a compact alternative to TRestRawSignalEvent
+/// for the analysis stages that do not need the signal waveforms. Each hit
+/// is defined by the signal ID where it was found, its time, amplitude,
+/// integral and width, and it is produced from the raw signals by
+/// TRestRawSignalToHitListProcess.
+///
+/// The hits are stored as flat arrays, one per hit parameter, using float
+/// precision. This layout is streamed by ROOT as a few contiguous blocks per
+/// event, so that the size of the stored events and the time required to
+/// read them back are a small fraction of those of the full waveforms.
+///
+/// The hits can be drawn with DrawEvent, showing the time and signal ID of
+/// each hit, with the marker size proportional to its amplitude.
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawHitListEvent
+///
+/// <hr>
+///
+
+#include "TRestRawHitListEvent.h"
+
+#include <TGraph.h>
+
+using namespace std;
+
+ClassImp(TRestRawHitListEvent);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawHitListEvent::TRestRawHitListEvent() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawHitListEvent::~TRestRawHitListEvent() {}
+
+///////////////////////////////////////////////
+/// \brief It removes all the hits. The capacity of the arrays is preserved.
+///
+void TRestRawHitListEvent::Initialize() {
+    TRestEvent::Initialize();
+
+    fSignalIds.clear();
+    fTimes.clear();
+    fAmplitudes.clear();
+    fIntegrals.clear();
+    fWidths.clear();
+
+    fPad = nullptr;
+}
+
+///////////////////////////////////////////////
+/// \brief It adds a new hit to the event
+///
+void TRestRawHitListEvent::AddHit(Int_t signalId, Float_t time, Float_t amplitude, Float_t integral,
+                                  Float_t width) {
+    fSignalIds.push_back(signalId);
+    fTimes.push_back(time);
+    fAmplitudes.push_back(amplitude);
+    fIntegrals.push_back(integral);
+    fWidths.push_back(width);
+}
+
+///////////////////////////////////////////////
+/// \brief It reserves the memory required to store *nHits* hits
+///
+void TRestRawHitListEvent::Reserve(size_t nHits) {
+    fSignalIds.reserve(nHits);
+    fTimes.reserve(nHits);
+    fAmplitudes.reserve(nHits);
+    fIntegrals.reserve(nHits);
+    fWidths.reserve(nHits);
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the sum of the amplitudes of all the hits
+///
+Double_t TRestRawHitListEvent::GetTotalAmplitude() const {
+    Double_t sum = 0;
+    for (const auto& amplitude : fAmplitudes) sum += amplitude;
+    return sum;
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the sum of the integrals of all the hits
+///
+Double_t TRestRawHitListEvent::GetTotalIntegral() const {
+    Double_t sum = 0;
+    for (const auto& integral : fIntegrals) sum += integral;
+    return sum;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints the hits on screen
+///
+void TRestRawHitListEvent::PrintEvent() {
+    TRestEvent::PrintEvent();
+
+    cout << "Number of hits : " << GetNumberOfHits() << endl;
+    for (int n = 0; n < GetNumberOfHits(); n++)
+        cout << "Hit " << n << " : Signal ID : " << fSignalIds[n] << " Time : " << fTimes[n]
+             << " Amplitude : " << fAmplitudes[n] << " Integral : " << fIntegrals[n]
+             << " Width : " << fWidths[n] << endl;
+}
+
+///////////////////////////////////////////////
+/// \brief It draws the time and signal ID of each hit in a TPad, the marker size
+/// being proportional to the hit amplitude.
+///
+TPad* TRestRawHitListEvent::DrawEvent(const TString& option) {
+    if (fPad != nullptr) {
+        delete fPad;
+        fPad = nullptr;
+    }
+
+    if (GetNumberOfHits() == 0) {
+        cout << "Empty event " << endl;
+        return nullptr;
+    }
+
+    fPad = new TPad(GetName(), " ", 0, 0, 1, 1);
+    fPad->Draw();
+    fPad->cd();
+
+    Float_t maxAmplitude = 0;
+    for (const auto& amplitude : fAmplitudes) maxAmplitude = max(maxAmplitude, amplitude);
+
+    TGraph* frame = new TGraph(GetNumberOfHits());
+    for (int n = 0; n < GetNumberOfHits(); n++) frame->SetPoint(n, fTimes[n], fSignalIds[n]);
+    frame->SetTitle(("Event ID " + to_string(GetID())).c_str());
+    frame->GetXaxis()->SetTitle("Time bin");
+    frame->GetYaxis()->SetTitle("Signal ID");
+    frame->SetMarkerStyle(0);
+    frame->Draw("AP");
+
+    for (int n = 0; n < GetNumberOfHits(); n++) {
+        TGraph* hit = new TGraph(1);
+        hit->SetPoint(0, fTimes[n], fSignalIds[n]);
+        hit->SetMarkerStyle(20);
+        hit->SetMarkerColor(kBlue);
+        hit->SetMarkerSize(maxAmplitude > 0 ? 0.4 + 2.0 * fAmplitudes[n] / maxAmplitude : 1);
+        hit->Draw("P");
+    }
+
+    return fPad;
+}
@@ -26,6 +26,12 @@
 /// TODO. This process might be obsolete today. It may need additional revision,
 /// validation, and documentation.
 ///
+/// The `eventSizeRange` and `hitsRange` pre-filter parameters defined at
+/// TRestRawToSignalProcess are evaluated on the frame headers of each event.
+/// The number of hits is estimated from `nItems` (partial readout) or taken as
+/// 272 channels per frame (full readout). The payload of rejected events is
+/// skipped without being decoded.
+///
 /// <hr>
 ///
 /// \warning **⚠ REST is under continous development.** This
@@ -48,6 +54,9 @@
 ///
 /// History of developments:
 ///
+/// 2026-October: Added header pre-filter. Recovery after a corrupted frame header
+///               uses the TRestRawToSignalProcess::SeekToPattern search. Error
+///               frame headers are accounted in the common decoding statistics.
 ///
 /// \class      TRestRawMultiCoBoAsAdToSignalProcess
 /// \author     Unknown
@@ -117,20 +126,18 @@ Bool_t TRestRawMultiCoBoAsAdToSignalProcess::InitializeStartTimeStampFromFilenam
     return kTRUE;
 }
 
-vector<int> fileerrors;
 void TRestRawMultiCoBoAsAdToSignalProcess::InitProcess() {
     // fDataFrame.clear();
     // fHeaderFrame.clear();
-    // fileerrors.clear();
 
     // for (int n = 0; n < fInputFiles.size(); n++) {
     //    CoBoHeaderFrame hdrtmp;
     //    fHeaderFrame.push_back(hdrtmp);
-    //    fileerrors.push_back(0);
     //}
 
     fRunOrigin = fRunInfo->GetRunNumber();
     fCurrentEvent = -1;
+    ResetStatistics();
 
     if (fRunInfo->GetStartTimestamp() != 0) {
         fStartTimeStamp = TTimeStamp(fRunInfo->GetStartTimestamp());
@@ -146,7 +153,6 @@ Bool_t TRestRawMultiCoBoAsAdToSignalProcess::AddInputFile(const string& file) {
     if (TRestRawToSignalProcess::AddInputFile(file)) {
         CoBoHeaderFrame hdrtmp;
         fHeaderFrame.push_back(hdrtmp);
-        fileerrors.push_back(0);
 
         int i = fHeaderFrame.size() - 1;
         if (fread(fHeaderFrame[i].frameHeader, 256, 1, fInputFiles[i]) != 1 || feof(fInputFiles[i])) {
@@ -177,13 +183,16 @@ Bool_t TRestRawMultiCoBoAsAdToSignalProcess::AddInputFile(const string& file) {
 TRestEvent* TRestRawMultiCoBoAsAdToSignalProcess::ProcessEvent(TRestEvent* inputEvent) {
     fSignalEvent->Initialize();
 
-    if (EndReading()) {
-        return nullptr;
-    }
-    if (!FillBuffer()) {
-        fSignalEvent->SetOK(false);
-        return fSignalEvent;
-    }
+    // events rejected by the header pre-filter are skipped without being built
+    do {
+        if (EndReading()) {
+            return nullptr;
+        }
+        if (!FillBuffer()) {
+            fSignalEvent->SetOK(false);
+            return fSignalEvent;
+        }
+    } while (fEventRejected);
 
     // Int_t nextId = GetLowestEventId();
 
@@ -206,7 +215,7 @@ TRestEvent* TRestRawMultiCoBoAsAdToSignalProcess::ProcessEvent(TRestEvent* input
                     signal.Initialize();
                     signal.SetSignalID(m + data->asadId * 272);
 
-                    for (int j = 0; j < 512; j++) signal.AddPoint((Short_t)data->data[m][j]);
+                    signal.AddPoints(data->data[m], 512);
 
                     fSignalEvent->AddSignal(signal);
 
@@ -236,19 +245,11 @@ TRestEvent* TRestRawMultiCoBoAsAdToSignalProcess::ProcessEvent(TRestEvent* input
     // cout << fSignalEvent->GetNumberOfSignals() << endl;
     // if( fSignalEvent->GetNumberOfSignals( ) == 0 ) return nullptr;
 
+    AddEvent();
     return fSignalEvent;
 }
 
-void TRestRawMultiCoBoAsAdToSignalProcess::EndProcess() {
-    for (unsigned int i = 0; i < fileerrors.size(); i++) {
-        if (fileerrors[i] > 0) {
-            RESTWarning << "Found " << fileerrors[i] << " error frame headers in file " << i << RESTendl;
-            RESTWarning << "\"" << fInputFileNames[i] << "\"" << RESTendl;
-        }
-    }
-
-    fileerrors.clear();
-}
+void TRestRawMultiCoBoAsAdToSignalProcess::EndProcess() { TRestRawToSignalProcess::EndProcess(); }
 
 // true: finish filling
 // false: error when filling
@@ -286,6 +287,26 @@ bool TRestRawMultiCoBoAsAdToSignalProcess::FillBuffer() {
     }
     fCurrentEvent = evt;
 
+    // header pre-filter, evaluated on the frame headers already read for the current event
+    fEventRejected = false;
+    if (fEventSizeRange.X() >= 0 || fEventSizeRange.Y() >= 0 || fHitsRange.X() >= 0 || fHitsRange.Y() >= 0) {
+        Long64_t eventSize = 0;
+        Int_t nHits = 0;
+        for (unsigned int i = 0; i < fHeaderFrame.size(); i++) {
+            if (fInputFiles[i] == nullptr || fHeaderFrame[i].eventIdx != (unsigned int)fCurrentEvent)
+                continue;
+            eventSize += fHeaderFrame[i].frameSize;
+            // partial readout items are single samples, full readout frames contain all 272 channels
+            nHits += fHeaderFrame[i].frameType == 2 ? 272 : fHeaderFrame[i].nItems / 512;
+        }
+        if (!AcceptEventSize(eventSize) || !AcceptHits(nHits)) {
+            fEventRejected = true;
+            fPreFilterRejected++;
+            RESTDebug << "Event " << fCurrentEvent << " rejected by header pre-filter (size " << eventSize
+                      << ", hits " << nHits << ")" << RESTendl;
+        }
+    }
+
     // loop for each file
     for (unsigned int i = 0; i < fHeaderFrame.size(); i++) {
         if (fInputFiles[i] == nullptr) {
@@ -308,9 +329,22 @@ bool TRestRawMultiCoBoAsAdToSignalProcess::FillBuffer() {
 
             // reading data according to the header
             unsigned int type = fHeaderFrame[i].frameType;
-            if (fHeaderFrame[i].frameHeader[0] == 0x08 && type == 1)  // partial readout
+            if (fEventRejected && fHeaderFrame[i].frameHeader[0] == 0x08 && (type == 1 || type == 2)) {
+                // skip the payload of a rejected event
+                long payloadSize = type == 1 ? (long)fHeaderFrame[i].frameSize - 256 : 278528;
+                if (payloadSize > 0) {
+                    if (fseek(fInputFiles[i], payloadSize, SEEK_CUR) != 0) {
+                        fclose(fInputFiles[i]);
+                        fInputFiles[i] = nullptr;
+                        fHeaderFrame[i].eventIdx = (unsigned int)4294967295;
+                        break;
+                    }
+                    totalBytesReaded += payloadSize;
+                }
+            } else if (fHeaderFrame[i].frameHeader[0] == 0x08 && type == 1)  // partial readout
             {
                 ReadFrameDataP(fInputFiles[i], fHeaderFrame[i]);
+                AddFrame();
             } else if (fHeaderFrame[i].frameHeader[0] == 0x08 && type == 2)  // full readout
             {
                 if (fread(frameDataF, 2048, 136, fInputFiles[i]) != 136 || feof(fInputFiles[i])) {
@@ -321,6 +355,7 @@ bool TRestRawMultiCoBoAsAdToSignalProcess::FillBuffer() {
                 }
                 totalBytesReaded += 278528;
                 ReadFrameDataF(fHeaderFrame[i]);
+                AddFrame();
             } else {
                 fclose(fInputFiles[i]);
                 fInputFiles[i] = nullptr;
@@ -342,29 +377,29 @@ bool TRestRawMultiCoBoAsAdToSignalProcess::FillBuffer() {
                 RESTWarning << "in file " << i << " \"" << fInputFileNames[i] << "\"" << RESTendl;
                 if (fVerboseLevel > TRestStringOutput::REST_Verbose_Level::REST_Info) fHeaderFrame[i].Show();
                 RESTWarning << "trying to skip this event and find next header..." << RESTendl;
-                fileerrors[i] += 1;
+                AddBadFrame();
                 TRestStringOutput::REST_Verbose_Level tmp = fVerboseLevel;
                 bool found = false;
                 fVerboseLevel = TRestStringOutput::REST_Verbose_Level::REST_Silent;
-                for (int k = 0; k < 1088; k++)  // fullreadoutsize(278528)/headersize(256)=1088
-                {
-                    if (fread(fHeaderFrame[i].frameHeader, 256, 1, fInputFiles[i]) != 1 ||
-                        feof(fInputFiles[i])) {
-                        break;
-                    }
-                    totalBytesReaded += 256;
-                    if (ReadFrameHeader(fHeaderFrame[i])) {
-                        fVerboseLevel = tmp;
-                        RESTWarning << "Successfully found next header (EventId : "
-                                    << fHeaderFrame[i].eventIdx << ")" << RESTendl;
-                        if (fVerboseLevel > TRestStringOutput::REST_Verbose_Level::REST_Info)
-                            fHeaderFrame[i].Show();
-                        cout << endl;
-                        // GetChar();
-                        found = true;
-                        fSignalEvent->SetOK(false);
-                        break;
-                    }
+                // a full readout frame (278528 bytes) is the largest amount of data to be skipped
+                CoBoHeaderFrame& hdr = fHeaderFrame[i];
+                Long64_t skipped = SeekToPattern(
+                    fInputFiles[i], {0x08}, 256,
+                    [&](const UChar_t* buffer) {
+                        memcpy(hdr.frameHeader, buffer, 256);
+                        return ReadFrameHeader(hdr);
+                    },
+                    278528);
+                fVerboseLevel = tmp;
+                if (skipped >= 0 && fread(hdr.frameHeader, 256, 1, fInputFiles[i]) == 1) {
+                    totalBytesReaded += skipped + 256;
+                    // the corrupted header is also accounted as skipped
+                    fSkippedBytes += skipped + 256;
+                    RESTWarning << "Successfully found next header (EventId : " << hdr.eventIdx << ", + "
+                                << skipped << " byte)" << RESTendl;
+                    if (fVerboseLevel > TRestStringOutput::REST_Verbose_Level::REST_Info) hdr.Show();
+                    found = true;
+                    fSignalEvent->SetOK(false);
                 }
                 if (!found) {
                     fclose(fInputFiles[i]);
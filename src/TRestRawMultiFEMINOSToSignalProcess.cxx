@@ -25,6 +25,32 @@
 ///
 /// DOCUMENTATION TO BE WRITTEN (main description, methods, data members)
 ///
+/// ### Selective channel decoding
+///
+/// It is possible to restrict the decoding to a subset of DAQ channels. The
+/// ADC words belonging to a channel that is not selected are skipped directly
+/// at the frame level, without building the corresponding TRestRawSignal. If
+/// no selection is given, all channels are decoded.
+///
+/// \code
+/// <TRestRawMultiFEMINOSToSignalProcess name="daq" electronics="TCMFeminos" >
+///     <selectChannel id="17" />
+///     <selectChannels range="(288,575)" />
+/// </TRestRawMultiFEMINOSToSignalProcess>
+/// \endcode
+///
+/// ### Header pre-filter
+///
+/// The `eventSizeRange` (built events in TCM mode), `hitsRange` and
+/// `acceptedEventTypes` parameters defined at TRestRawToSignalProcess are
+/// evaluated on the event headers. The number of hits is the number of channel
+/// hit words of the event, which is the sum of the chip hit counters. A built
+/// event rejected by its size is skipped in the file without reading it. A
+/// built event is scanned for channel hit words before it is decoded, while the
+/// hits of an event spread over several frames are known only at its end. The
+/// ADC samples of a rejected event are not decoded, and the event is not
+/// returned.
+///
 /// \warning This process might be obsolete today. It may need additional
 /// revision, validation, and documentation. Use it under your own risk. If you
 /// find this process useful for your work feel free to use it, improve it,
@@ -56,6 +82,10 @@
 /// 2017-Aug: First implementation
 ///           Javier Galan
 ///
+/// 2026-October: Added selective channel decoding and header pre-filter. The frame
+///               words are now classified using a constexpr dispatch table. Blank
+///               events are accounted in the decoding statistics.
+///
 /// \class      TRestRawMultiFEMINOSToSignalProcess
 /// \author     Javier Galan
 ///
@@ -190,6 +220,105 @@ using namespace std;
 
 Int_t nChannels = 0;
 
+// Maximum DAQ channel id that can be encoded in a PFX_CARD_CHIP_CHAN_HIT_IX word
+#define MAX_DAQ_CHANNELS (32 * 4 * 72 + 128)
+
+// Word classes identified by the ReadFrame dispatch tables
+enum FeminosWordClass : unsigned char {
+    kWordOther = 0,
+    kWordChannelHit,
+    kWordAdcSample,
+    kWordStartOfEvent,
+    kWordEndOfEvent,
+    kWordEndOfFrame,
+    kWordStartOfBuiltEvent,
+    kWordEndOfBuiltEvent,
+    kWordSobeSize,
+    kWordLowByte  // the class is given by the low byte table
+};
+
+// Same classification, and same priority, as the original if/else chain of prefix masks
+constexpr unsigned char ClassifyFeminosWord(unsigned short w) {
+    return (w & PFX_14_BIT_CONTENT_MASK) == PFX_CARD_CHIP_CHAN_HIT_IX ? kWordChannelHit
+           : (w & PFX_12_BIT_CONTENT_MASK) == PFX_ADC_SAMPLE          ? kWordAdcSample
+           : (w & PFX_4_BIT_CONTENT_MASK) == PFX_START_OF_EVENT       ? kWordStartOfEvent
+           : (w & PFX_4_BIT_CONTENT_MASK) == PFX_END_OF_EVENT         ? kWordEndOfEvent
+           : (w & PFX_0_BIT_CONTENT_MASK) == PFX_END_OF_FRAME         ? kWordEndOfFrame
+           : w == PFX_START_OF_BUILT_EVENT                            ? kWordStartOfBuiltEvent
+           : w == PFX_END_OF_BUILT_EVENT                              ? kWordEndOfBuiltEvent
+           : w == PFX_SOBE_SIZE                                       ? kWordSobeSize
+                                                                      : kWordOther;
+}
+
+// Two-level dispatch table. Any word with a non-zero high byte is classified by its high byte
+// alone, while the 4-bit and 0-bit content prefixes (high byte 0x00) are resolved by the low byte.
+struct FeminosDispatchTable {
+    unsigned char high[256];
+    unsigned char low[256];
+
+    constexpr FeminosDispatchTable() : high(), low() {
+        for (int n = 0; n < 256; n++) {
+            high[n] = n == 0 ? (unsigned char)kWordLowByte : ClassifyFeminosWord((unsigned short)(n << 8));
+            low[n] = ClassifyFeminosWord((unsigned short)n);
+        }
+    }
+};
+
+constexpr FeminosDispatchTable kFeminosDispatch;
+
+// The number of samples acquired by the AGET electronics. Runs of ADC samples of this length are
+// checked and unpacked as fixed size blocks.
+constexpr int kAGETSamples = 512;
+
+// It returns true if the N words are all ADC samples. The words are checked without branches.
+template <int N>
+inline bool IsAdcSampleBlock(const unsigned short* p) {
+    unsigned short other = 0;
+    for (int n = 0; n < N; n++) other |= (p[n] & PFX_12_BIT_CONTENT_MASK) ^ PFX_ADC_SAMPLE;
+    return other == 0;
+}
+
+// It extracts the values of N ADC samples
+template <int N>
+inline void UnpackAdcSamples(const unsigned short* p, Int_t* samples) {
+    for (int n = 0; n < N; n++) samples[n] = GET_ADC_DATA(p[n]);
+}
+
+inline unsigned char GetWordClass(unsigned short w) {
+    unsigned char c = kFeminosDispatch.high[w >> 8];
+    return c == kWordLowByte ? kFeminosDispatch.low[w & 0xFF] : c;
+}
+
+// It counts the channel hit words between p and end, up to the end of frame, without decoding the
+// ADC samples. The words following each header are skipped as DecodeFrame does, since they may take
+// any value.
+inline int CountChannelHits(const unsigned short* p, const unsigned short* end) {
+    int hits = 0;
+    while (p < end) {
+        switch (GetWordClass(*p)) {
+            case kWordChannelHit:
+                hits++;
+                p++;
+                break;
+            case kWordStartOfEvent:
+                p += 6;  // Prefix, time stamp (3 words) and event count (2 words)
+                break;
+            case kWordEndOfEvent:
+                p += 2;  // Prefix and size lower 16-bit
+                break;
+            case kWordSobeSize:
+                p += 3;  // Prefix and built event size (2 words)
+                break;
+            case kWordEndOfFrame:
+                return hits;
+            default:
+                p++;
+                break;
+        }
+    }
+    return hits;
+}
+
 ClassImp(TRestRawMultiFEMINOSToSignalProcess);
 
 TRestRawMultiFEMINOSToSignalProcess::TRestRawMultiFEMINOSToSignalProcess() { Initialize(); }
@@ -215,8 +344,43 @@ void TRestRawMultiFEMINOSToSignalProcess::Initialize() {
     SetLibraryVersion(LIBRARY_VERSION);
 }
 
+void TRestRawMultiFEMINOSToSignalProcess::InitFromConfigFile() {
+    TRestRawToSignalProcess::InitFromConfigFile();
+
+    fSelectedChannelRanges.clear();
+
+    size_t pos = 0;
+    string selectDefinition;
+    while ((selectDefinition = GetKEYDefinition("selectChannel", pos)) != "") {
+        Int_t id = StringToInteger(GetFieldValue("id", selectDefinition));
+        fSelectedChannelRanges.push_back(TVector2(id, id));
+    }
+
+    pos = 0;
+    while ((selectDefinition = GetKEYDefinition("selectChannels", pos)) != "") {
+        TVector2 v = StringTo2DVector(GetFieldValue("range", selectDefinition));
+        if (v.X() >= 0 && v.Y() >= v.X()) fSelectedChannelRanges.push_back(v);
+    }
+}
+
 void TRestRawMultiFEMINOSToSignalProcess::InitProcess() {
     RESTDebug << "TRestRawMultiFeminos::InitProcess" << RESTendl;
+
+    ResetStatistics();
+    fLastEventType = -1;
+
+    fChannelSelected.clear();
+    if (!fSelectedChannelRanges.empty()) {
+        fChannelSelected.resize(MAX_DAQ_CHANNELS, false);
+        Int_t nSelected = 0;
+        for (const auto& range : fSelectedChannelRanges) {
+            for (int id = (Int_t)range.X(); id <= (Int_t)range.Y() && id < MAX_DAQ_CHANNELS; id++) {
+                if (!fChannelSelected[id]) nSelected++;
+                fChannelSelected[id] = true;
+            }
+        }
+        RESTInfo << "MultiFEMINOS: decoding " << nSelected << " selected DAQ channels" << RESTendl;
+    }
     // Reading binary file header
 
     if (!fInputFileNames.empty() && TRestTools::GetFileNameExtension(fInputFileNames[0]) != "aqs") {
@@ -288,6 +452,8 @@ TRestEvent* TRestRawMultiFEMINOSToSignalProcess::ProcessEvent(TRestEvent* inputE
 
         nChannels = 0;
         Bool_t endOfEvent = false;
+        Bool_t skipPayload = false;
+        fRejectEvent = false;
 
         fSignalEvent->Initialize();
 
@@ -332,6 +498,9 @@ TRestEvent* TRestRawMultiFEMINOSToSignalProcess::ProcessEvent(TRestEvent* inputE
                     nb_sh -= 3;         // we have already read three short words from this event
                     fr_offset = 8;
 
+                    // The payload of a rejected built event is not even read
+                    if (!AcceptEventSize(fr_sz)) fRejectEvent = skipPayload = true;
+
                     done = 1;
                 } else if (((*sh & PFX_9_BIT_CONTENT_MASK) == PFX_START_OF_DFRAME) ||
                            ((*sh & PFX_9_BIT_CONTENT_MASK) == PFX_START_OF_CFRAME) ||
@@ -358,6 +527,18 @@ TRestEvent* TRestRawMultiFEMINOSToSignalProcess::ProcessEvent(TRestEvent* inputE
                 }
             }
 
+            if (!endOfEvent && skipPayload) {
+                if (fseek(fInputBinFile, sizeof(unsigned short) * nb_sh, SEEK_CUR) != 0) {
+                    printf("Error: could not skip %d bytes.\n", (nb_sh * 2));
+                    exit(1);
+                }
+                totalBytesReaded += sizeof(unsigned short) * nb_sh;
+                skipPayload = false;
+
+                AddFrame();
+                continue;
+            }
+
             // Read binary frame
             if (!endOfEvent) {
                 if (fread(&(cur_fr[fr_offset]), sizeof(unsigned short), nb_sh, fInputBinFile) != nb_sh) {
@@ -371,6 +552,13 @@ TRestEvent* TRestRawMultiFEMINOSToSignalProcess::ProcessEvent(TRestEvent* inputE
                 cur_fr[0] = 0x00;
                 cur_fr[1] = 0x00;
 
+                // A built event contains all its hits, which are counted before decoding it
+                if (fr_offset == 8 && (fHitsRange.X() >= 0 || fHitsRange.Y() >= 0)) {
+                    const unsigned short* payload = (const unsigned short*)&(cur_fr[2]);
+                    if (!AcceptHits(CountChannelHits(payload, payload + fr_sz / 2))) fRejectEvent = true;
+                }
+
+                AddFrame();
                 endOfEvent = ReadFrame((void*)&(cur_fr[2]), fr_sz);
             }
         }
@@ -395,10 +583,17 @@ TRestEvent* TRestRawMultiFEMINOSToSignalProcess::ProcessEvent(TRestEvent* inputE
             }
         }
 
-        if (fSignalEvent->GetNumberOfSignals() != 0) {
+        if (!AcceptHits(nChannels)) fRejectEvent = true;
+
+        if (fRejectEvent) {
+            fPreFilterRejected++;
+            RESTDebug << "Event " << fSignalEvent->GetID() << " rejected by header pre-filter" << RESTendl;
+        } else if (fSignalEvent->GetNumberOfSignals() != 0) {
+            AddEvent();
             return fSignalEvent;
         } else {
-            RESTWarning << "blank event " << fSignalEvent->GetID() << "! skipping..." << RESTendl;
+            fNEmptyEvents++;
+            RESTDebug << "blank event " << fSignalEvent->GetID() << "! skipping..." << RESTendl;
         }
     }
 
@@ -406,7 +601,22 @@ TRestEvent* TRestRawMultiFEMINOSToSignalProcess::ProcessEvent(TRestEvent* inputE
     return nullptr;
 }
 
+///////////////////////////////////////////////
+/// \brief It decodes a frame (or a built event) stored in memory, and adds the
+/// signals found to fSignalEvent.
+///
+/// The verbosity level is checked only once per frame, and the frame is then
+/// decoded by a version of DecodeFrame specialized at compile time, so that the
+/// non-verbose hot loop does not contain any printout check.
+///
 Bool_t TRestRawMultiFEMINOSToSignalProcess::ReadFrame(void* fr, int fr_sz) {
+    if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Info)
+        return DecodeFrame<true>(fr, fr_sz);
+    return DecodeFrame<false>(fr, fr_sz);
+}
+
+template <Bool_t verbose>
+Bool_t TRestRawMultiFEMINOSToSignalProcess::DecodeFrame(void* fr, int fr_sz) {
     Bool_t endOfEvent = false;
 
     unsigned short* p;
@@ -414,171 +624,208 @@ Bool_t TRestRawMultiFEMINOSToSignalProcess::ReadFrame(void* fr, int fr_sz) {
     unsigned short r0, r1, r2;
     unsigned short n0, n1;
     unsigned short cardNumber, chipNumber, daqChannel;
+    unsigned short eventType;
     unsigned int tmp;
     int tmp_i[10];
     int si;
+    Int_t samples[kAGETSamples];
+
+    const Bool_t debug =
+        verbose && GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug;
 
     p = (unsigned short*)fr;
+    const unsigned short* end = p + fr_sz / 2;
 
     done = 0;
     si = 0;
 
-    if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug)
-        printf("ReadFrame: Frame payload: %d bytes\n", fr_sz);
+    if (debug) printf("ReadFrame: Frame payload: %d bytes\n", fr_sz);
 
     Int_t showSamples = fShowSamples;
 
     TRestRawSignal sgnl;
     sgnl.SetSignalID(-1);
     while (!done) {
-        // Is it a prefix for 14-bit content?
-        if ((*p & PFX_14_BIT_CONTENT_MASK) == PFX_CARD_CHIP_CHAN_HIT_IX) {
-            if (sgnl.GetSignalID() >= 0 && sgnl.GetNumberOfPoints() >= fMinPoints)
-                fSignalEvent->AddSignal(sgnl);
+        switch (GetWordClass(*p)) {
+            // Is it a prefix for 14-bit content?
+            case kWordChannelHit:
+                if (sgnl.GetSignalID() >= 0 && sgnl.GetNumberOfPoints() >= fMinPoints)
+                    fSignalEvent->AddSignal(sgnl);
 
-            cardNumber = GET_CARD_IX(*p);
-            chipNumber = GET_CHIP_IX(*p);
-            daqChannel = GET_CHAN_IX(*p);
+                cardNumber = GET_CARD_IX(*p);
+                chipNumber = GET_CHIP_IX(*p);
+                daqChannel = GET_CHAN_IX(*p);
 
-            if (daqChannel >= 0) {
                 daqChannel += cardNumber * 4 * 72 + chipNumber * 72;
                 nChannels++;
-            }
 
-            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug)
-                printf("ReadFrame: Card %02d Chip %01d Daq Channel %02d\n", cardNumber, chipNumber,
-                       daqChannel);
-            p++;
-            si = 0;
+                if (debug)
+                    printf("ReadFrame: Card %02d Chip %01d Daq Channel %02d\n", cardNumber, chipNumber,
+                           daqChannel);
+                p++;
+                si = 0;
 
-            sgnl.Initialize();
-            sgnl.SetSignalID(daqChannel);
+                sgnl.Initialize();
 
-        }
-        // Is it a prefix for 12-bit content?
-        else if ((*p & PFX_12_BIT_CONTENT_MASK) == PFX_ADC_SAMPLE) {
-            r0 = GET_ADC_DATA(*p);
-            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug) {
-                if (showSamples > 0) printf("ReadFrame: %03d 0x%04x (%4d)\n", si, r0, r0);
-                showSamples--;
-            }
-            if (sgnl.GetSignalID() >= 0) sgnl.AddPoint((Short_t)r0);
-            p++;
-            si++;
-        }
-        // Is it a prefix for 4-bit content?
-        else if ((*p & PFX_4_BIT_CONTENT_MASK) == PFX_START_OF_EVENT) {
-            r0 = GET_EVENT_TYPE(*p);
-            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug)
-                printf("ReadFrame: -- Start of Event (Type %01d) --\n", r0);
-            p++;
+                if (fRejectEvent || !IsChannelSelected(daqChannel)) {
+                    // Skip the ADC samples of this channel without decoding them
+                    sgnl.SetSignalID(-1);
+                    while ((*p & PFX_12_BIT_CONTENT_MASK) == PFX_ADC_SAMPLE) p++;
+                    break;
+                }
 
-            // Time Stamp lower 16-bit
-            r0 = *p;
-            p++;
+                sgnl.SetSignalID(daqChannel);
+                break;
 
-            // Time Stamp middle 16-bit
-            r1 = *p;
-            p++;
+            // Is it a prefix for 12-bit content? The complete run of ADC samples is consumed here
+            case kWordAdcSample:
+                if (sgnl.GetSignalID() < 0) {
+                    while ((*p & PFX_12_BIT_CONTENT_MASK) == PFX_ADC_SAMPLE) p++;
+                    break;
+                }
+                // The complete acquisition windows are decoded as fixed size blocks
+                while (!debug && end - p >= kAGETSamples && IsAdcSampleBlock<kAGETSamples>(p)) {
+                    UnpackAdcSamples<kAGETSamples>(p, samples);
+                    sgnl.AddPoints(samples, kAGETSamples);
+                    p += kAGETSamples;
+                    si += kAGETSamples;
+                }
+                while ((*p & PFX_12_BIT_CONTENT_MASK) == PFX_ADC_SAMPLE) {
+                    r0 = GET_ADC_DATA(*p);
+                    if (debug) {
+                        if (showSamples > 0) printf("ReadFrame: %03d 0x%04x (%4d)\n", si, r0, r0);
+                        showSamples--;
+                    }
+                    sgnl.AddPoint((Short_t)r0);
+                    p++;
+                    si++;
+                }
+                break;
+
+            // Is it a prefix for 4-bit content?
+            case kWordStartOfEvent:
+                eventType = GET_EVENT_TYPE(*p);
+                if (debug) printf("ReadFrame: -- Start of Event (Type %01d) --\n", eventType);
+                p++;
+
+                // Time Stamp lower 16-bit
+                r0 = *p;
+                p++;
+
+                // Time Stamp middle 16-bit
+                r1 = *p;
+                p++;
+
+                // Time Stamp upper 16-bit
+                r2 = *p;
+                p++;
+
+                if (debug) {
+                    printf("ReadFrame: Time 0x%04x 0x%04x 0x%04x\n", r2, r1, r0);
+                    printf("Timestamp: 0x%04x 0x%04x 0x%04x\n", r2, r1, r0);
+                    cout << "TimeStamp " << tStart + (2147483648 * r2 + 32768 * r1 + r0) * 2e-8 << endl;
+                }
 
-            // Time Stamp upper 16-bit
-            r2 = *p;
-            p++;
+                // Set timestamp and event ID
+
+                // Event Count lower 16-bit
+                n0 = *p;
+                p++;
+
+                // Event Count upper 16-bit
+                n1 = *p;
+                p++;
+
+                tmp = (((unsigned int)n1) << 16) | ((unsigned int)n0);
+                if (verbose) printf("ReadFrame: Event_Count 0x%08x (%d)\n", tmp, tmp);
+
+                // Some times the end of the frame contains the header of the next event.
+                // Then, in the attempt to read the header of next event, we must avoid
+                // that it overwrites the already assigned id. In that case (id != 0), we
+                // do nothing, and we store the values at fLastXX variables, that we will
+                // use that for next event.
+                if (fSignalEvent->GetID() == 0) {
+                    Int_t type = eventType;
+                    if (fLastEventId == 0) {
+                        fSignalEvent->SetID(tmp);
+                        fSignalEvent->SetTime(tStart + (2147483648 * r2 + 32768 * r1 + r0) * 2e-8);
+                    } else {
+                        fSignalEvent->SetID(fLastEventId);
+                        fSignalEvent->SetTime(fLastTimeStamp);
+                        type = fLastEventType;
+                    }
+                    if (!AcceptEventType(type)) fRejectEvent = true;
+                }
 
-            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug) {
-                printf("ReadFrame: Time 0x%04x 0x%04x 0x%04x\n", r2, r1, r0);
-                printf("Timestamp: 0x%04x 0x%04x 0x%04x\n", r2, r1, r0);
-                cout << "TimeStamp " << tStart + (2147483648 * r2 + 32768 * r1 + r0) * 2e-8 << endl;
-            }
+                fLastEventType = eventType;
+                fLastEventId = tmp;
+                fLastTimeStamp = tStart + (2147483648 * r2 + 32768 * r1 + r0) * 2e-8;
 
-            // Set timestamp and event ID
-
-            // Event Count lower 16-bit
-            n0 = *p;
-            p++;
-
-            // Event Count upper 16-bit
-            n1 = *p;
-            p++;
-
-            tmp = (((unsigned int)n1) << 16) | ((unsigned int)n0);
-            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Info)
-                printf("ReadFrame: Event_Count 0x%08x (%d)\n", tmp, tmp);
-
-            // Some times the end of the frame contains the header of the next event.
-            // Then, in the attempt to read the header of next event, we must avoid
-            // that it overwrites the already assigned id. In that case (id != 0), we
-            // do nothing, and we store the values at fLastXX variables, that we will
-            // use that for next event.
-            if (fSignalEvent->GetID() == 0) {
-                if (fLastEventId == 0) {
-                    fSignalEvent->SetID(tmp);
-                    fSignalEvent->SetTime(tStart + (2147483648 * r2 + 32768 * r1 + r0) * 2e-8);
+                // If it is the first event we use it to define the run start time
+                if (fCounter == 0) {
+                    fRunInfo->SetStartTimeStamp(fLastTimeStamp);
+                    fCounter++;
                 } else {
-                    fSignalEvent->SetID(fLastEventId);
-                    fSignalEvent->SetTime(fLastTimeStamp);
+                    // and we keep updating the end run time
+                    fRunInfo->SetEndTimeStamp(fLastTimeStamp);
                 }
-            }
 
-            fLastEventId = tmp;
-            fLastTimeStamp = tStart + (2147483648 * r2 + 32768 * r1 + r0) * 2e-8;
-
-            // If it is the first event we use it to define the run start time
-            if (fCounter == 0) {
-                fRunInfo->SetStartTimeStamp(fLastTimeStamp);
-                fCounter++;
-            } else {
-                // and we keep updating the end run time
-                fRunInfo->SetEndTimeStamp(fLastTimeStamp);
-            }
-
-            fSignalEvent->SetRunOrigin(fRunOrigin);
-            fSignalEvent->SetSubRunOrigin(fSubRunOrigin);
-        } else if ((*p & PFX_4_BIT_CONTENT_MASK) == PFX_END_OF_EVENT) {
-            tmp = ((unsigned int)GET_EOE_SIZE(*p)) << 16;
-            p++;
-            tmp = tmp + (unsigned int)*p;
-            p++;
-            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug)
-                printf("ReadFrame: ----- End of Event ----- (size %d bytes)\n", tmp);
-            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug) GetChar();
-
-            if (fElectronicsType == "SingleFeminos") endOfEvent = true;
-        }
+                fSignalEvent->SetRunOrigin(fRunOrigin);
+                fSignalEvent->SetSubRunOrigin(fSubRunOrigin);
+                break;
+
+            case kWordEndOfEvent:
+                tmp = ((unsigned int)GET_EOE_SIZE(*p)) << 16;
+                p++;
+                tmp = tmp + (unsigned int)*p;
+                p++;
+                if (debug) {
+                    printf("ReadFrame: ----- End of Event ----- (size %d bytes)\n", tmp);
+                    GetChar();
+                }
 
-        // Is it a prefix for 0-bit content?
-        else if ((*p & PFX_0_BIT_CONTENT_MASK) == PFX_END_OF_FRAME) {
-            if (sgnl.GetSignalID() >= 0 && sgnl.GetNumberOfPoints() >= fMinPoints)
-                fSignalEvent->AddSignal(sgnl);
-
-            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug)
-                printf("ReadFrame: ----- End of Frame -----\n");
-            p++;
-            done = 1;
-        } else if (*p == PFX_START_OF_BUILT_EVENT) {
-            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug)
-                printf("ReadFrame: ***** Start of Built Event *****\n");
-            p++;
-        } else if (*p == PFX_END_OF_BUILT_EVENT) {
-            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug)
-                printf("ReadFrame: ***** End of Built Event *****\n\n");
-            p++;
-        } else if (*p == PFX_SOBE_SIZE) {
-            // Skip header
-            p++;
-
-            // Built Event Size lower 16-bit
-            r0 = *p;
-            p++;
-            // Built Event Size upper 16-bit
-            r1 = *p;
-            p++;
-            tmp_i[0] = (int)((r1 << 16) | (r0));
-
-            if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug)
-                printf("ReadFrame: ***** Start of Built Event - Size = %d bytes *****\n", tmp_i[0]);
-        } else {
-            p++;
+                if (fElectronicsType == "SingleFeminos") endOfEvent = true;
+                break;
+
+            // Is it a prefix for 0-bit content?
+            case kWordEndOfFrame:
+                if (sgnl.GetSignalID() >= 0 && sgnl.GetNumberOfPoints() >= fMinPoints)
+                    fSignalEvent->AddSignal(sgnl);
+
+                if (debug) printf("ReadFrame: ----- End of Frame -----\n");
+                p++;
+                done = 1;
+                break;
+
+            case kWordStartOfBuiltEvent:
+                if (debug) printf("ReadFrame: ***** Start of Built Event *****\n");
+                p++;
+                break;
+
+            case kWordEndOfBuiltEvent:
+                if (debug) printf("ReadFrame: ***** End of Built Event *****\n\n");
+                p++;
+                break;
+
+            case kWordSobeSize:
+                // Skip header
+                p++;
+
+                // Built Event Size lower 16-bit
+                r0 = *p;
+                p++;
+                // Built Event Size upper 16-bit
+                r1 = *p;
+                p++;
+                tmp_i[0] = (int)((r1 << 16) | (r0));
+
+                if (debug)
+                    printf("ReadFrame: ***** Start of Built Event - Size = %d bytes *****\n", tmp_i[0]);
+                break;
+
+            default:
+                p++;
+                break;
         }
     }
 
@@ -0,0 +1,472 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawMultiSourceToSignalProcess builds events from several raw
+/// data streams acquired in parallel, as a FEMINOS TPC together with a TDS
+/// scope or a veto system, so that the correlation between them is already
+/// available in the main processing chain.
+///
+/// Each input stream, or source, is decoded by its own TRestRawToSignalProcess
+/// which is instantiated and driven internally by this process. The events
+/// of all the sources are merged in time order using a k-way heap merge, and
+/// the events whose timestamps are found inside a coincidence window, starting
+/// at the earliest one, are combined into a single TRestRawSignalEvent. A
+/// source contributes at most one event to each combined event, the remaining
+/// events are kept for the next ones.
+///
+/// Each source reads ahead, at most, `bufferDepth` events which are kept time
+/// ordered. Therefore, the events of one source do not need to be strictly
+/// ordered in time, as long as the disorder does not exceed the buffer depth.
+///
+/// The signal ids of each source are shifted by its `idOffset`, so that the
+/// channels of the different sources can be identified, e.g. by
+/// TRestRawVetoAnalysisProcess, in the combined event. The combined event
+/// takes the id of the event of the first source found in it, and the time
+/// of the earliest event.
+///
+/// ### Parameters
+/// * **coincidenceWindow**: maximum time difference, in seconds, between the
+/// events combined. Default is 1e-6.
+/// * **bufferDepth**: number of events read ahead for each source. Default is 8.
+/// * **requirePrimary**: if true, combined events without an event from the
+/// first source defined are discarded. Default is false.
+///
+/// Each source is defined with a `<source>` key with the following fields:
+/// * **type**: the class name of the decoder, e.g. TRestRawMultiFEMINOSToSignalProcess.
+/// * **name**: the name of the decoder section to be loaded from the RML file.
+/// * **config**: the RML file where the decoder section is found. If not given
+/// the file defining this process is used.
+/// * **file**: the input file name, or pattern, of the source. If not given the
+/// run input files are used.
+/// * **idOffset**: offset added to the signal ids of the source. Default is 0.
+/// * **timeOffset**: offset, in seconds, added to the event timestamps of the
+/// source. Default is 0.
+///
+/// ### Observables
+/// * **nSources**: number of sources contributing to the combined event.
+/// * **sourcesMask**: bit mask with the sources contributing, the bit `n`
+/// corresponding to the n-th source defined. This is the reason why at most 31
+/// sources can be defined.
+///
+/// ### Examples
+/// \code
+/// <TRestRawMultiFEMINOSToSignalProcess name="tpc" electronics="TCMFeminos" />
+/// <TRestRawTDSToSignalProcess name="veto" electronics="TDS" />
+///
+/// <addProcess type="TRestRawMultiSourceToSignalProcess" name="builder" value="ON"
+///             coincidenceWindow="20e-6" bufferDepth="16" requirePrimary="true" >
+///     <source type="TRestRawMultiFEMINOSToSignalProcess" name="tpc" />
+///     <source type="TRestRawTDSToSignalProcess" name="veto" file="data/veto_R01133.dat"
+///             idOffset="10000" timeOffset="0" />
+/// </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawMultiSourceToSignalProcess
+///
+/// <hr>
+///
+#include "TRestRawMultiSourceToSignalProcess.h"
+
+#include <TClass.h>
+#include <TRestTools.h>
+
+using namespace std;
+
+ClassImp(TRestRawMultiSourceToSignalProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawMultiSourceToSignalProcess::TRestRawMultiSourceToSignalProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawMultiSourceToSignalProcess::TRestRawMultiSourceToSignalProcess(const char* configFilename) {
+    Initialize();
+
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawMultiSourceToSignalProcess::~TRestRawMultiSourceToSignalProcess() { ClearSources(); }
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawMultiSourceToSignalProcess::Initialize() {
+    TRestRawToSignalProcess::Initialize();
+
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fElectronicsType = "MultiSource";
+}
+
+///////////////////////////////////////////////
+/// \brief It reads the builder parameters and the `<source>` definitions
+///
+/// TRestRawToSignalProcess::InitFromConfigFile is not called on purpose. Its
+/// parameters (electronics, minPoints, showSamples and the header pre-filter)
+/// apply to the decoding of a binary file, and they are read by each source
+/// from its own section. The builder does not decode any file, and its
+/// electronics type is fixed at Initialize. The only shared parameter,
+/// progressInterval, is read here.
+///
+void TRestRawMultiSourceToSignalProcess::InitFromConfigFile() {
+    fCoincidenceWindow = StringToDouble(GetParameter("coincidenceWindow", "1e-6"));
+    fBufferDepth = StringToInteger(GetParameter("bufferDepth", "8"));
+    fRequirePrimary = StringToBool(GetParameter("requirePrimary", "false"));
+    fProgressInterval = StringToDouble(GetParameter("progressInterval", "10"));
+
+    if (fBufferDepth < 1) fBufferDepth = 1;
+
+    fSourceTypes.clear();
+    fSourceNames.clear();
+    fSourceConfigs.clear();
+    fSourceFiles.clear();
+    fSourceIdOffsets.clear();
+    fSourceTimeOffsets.clear();
+
+    size_t pos = 0;
+    string sourceDefinition;
+    while ((sourceDefinition = GetKEYDefinition("source", pos)) != "") {
+        auto field = [&](const string& name, const string& defaultValue) {
+            string value = GetFieldValue(name, sourceDefinition);
+            if (value == "Not defined" || value.empty()) return defaultValue;
+            return value;
+        };
+
+        string type = field("type", "");
+        if (type.empty()) {
+            RESTWarning << "TRestRawMultiSourceToSignalProcess: source without type is ignored" << RESTendl;
+            continue;
+        }
+
+        fSourceTypes.push_back(type);
+        fSourceNames.push_back(field("name", ""));
+        fSourceConfigs.push_back(field("config", (string)GetConfigFileName()));
+        fSourceFiles.push_back(field("file", ""));
+        fSourceIdOffsets.push_back(StringToInteger(field("idOffset", "0")));
+        fSourceTimeOffsets.push_back(StringToDouble(field("timeOffset", "0")));
+    }
+
+    if (fSourceTypes.empty()) {
+        RESTError << "TRestRawMultiSourceToSignalProcess: no sources defined!" << RESTendl;
+        exit(1);
+    }
+
+    // Each source is given one bit of the sourcesMask observable
+    if (fSourceTypes.size() > kMaxSources) {
+        RESTError << "TRestRawMultiSourceToSignalProcess: " << fSourceTypes.size()
+                  << " sources defined, the maximum is " << kMaxSources << RESTendl;
+        exit(1);
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief The input files given by the run are kept for the sources without
+/// their own `file` definition. They are opened at InitProcess.
+///
+Bool_t TRestRawMultiSourceToSignalProcess::OpenInputFiles(const vector<string>& files) {
+    fRunInputFiles = files;
+    nFiles = files.size();
+    return true;
+}
+
+///////////////////////////////////////////////
+/// \brief It adds a run input file to be used by the sources without their
+/// own `file` definition
+///
+Bool_t TRestRawMultiSourceToSignalProcess::AddInputFile(const string& file) {
+    fRunInputFiles.push_back(file);
+    nFiles = fRunInputFiles.size();
+    return true;
+}
+
+///////////////////////////////////////////////
+/// \brief It instantiates and initializes the decoder of each source, and
+/// fills the time ordered queue with the first events of each source
+///
+void TRestRawMultiSourceToSignalProcess::InitProcess() {
+    ClearSources();
+    ResetStatistics();
+    fOrphanEvents = 0;
+
+    totalBytes = 0;
+    for (size_t n = 0; n < fSourceTypes.size(); n++) {
+        TClass* cl = TClass::GetClass(fSourceTypes[n].c_str());
+        TRestRawToSignalProcess* source = nullptr;
+        if (cl != nullptr && cl->InheritsFrom(TRestRawToSignalProcess::Class()))
+            source = (TRestRawToSignalProcess*)cl->New();
+        if (source == nullptr) {
+            RESTError << "TRestRawMultiSourceToSignalProcess: " << fSourceTypes[n]
+                      << " is not a raw data decoder!" << RESTendl;
+            exit(1);
+        }
+
+        source->LoadConfig(fSourceConfigs[n], fSourceNames[n]);
+        source->SetRunInfo(fRunInfo);
+        source->SetVerboseLevel(GetVerboseLevel());
+
+        vector<string> files = fRunInputFiles;
+        if (!fSourceFiles[n].empty()) files = TRestTools::GetFilesMatchingPattern(fSourceFiles[n]);
+        source->OpenInputFiles(files);
+        source->InitProcess();
+
+        totalBytes += source->GetTotalBytes();
+        fSources.push_back(source);
+    }
+
+    fSourceEvents.assign(fSources.size(), 0);
+    fPending.assign(fSources.size(), 0);
+    fExhausted.assign(fSources.size(), false);
+
+    // Each source holds up to fBufferDepth events in the queue plus the one being merged
+    for (size_t n = 0; n < fSources.size() * (fBufferDepth + 1); n++)
+        fEventPool.push_back(new TRestRawSignalEvent());
+    fFreeEvents = fEventPool;
+
+    for (size_t n = 0; n < fSources.size(); n++) FillSource(n);
+}
+
+///////////////////////////////////////////////
+/// \brief It reads events from the given source until its buffer is full or
+/// the source is exhausted. The events are copied, with the source offsets
+/// applied, and pushed into the time ordered queue.
+///
+void TRestRawMultiSourceToSignalProcess::FillSource(Int_t source) {
+    while (!fExhausted[source] && fPending[source] < fBufferDepth) {
+        TRestRawSignalEvent* sourceEvent = (TRestRawSignalEvent*)fSources[source]->ProcessEvent(nullptr);
+        if (sourceEvent == nullptr) {
+            fExhausted[source] = true;
+            RESTDebug << "TRestRawMultiSourceToSignalProcess: source " << source << " exhausted" << RESTendl;
+            break;
+        }
+
+        TRestRawSignalEvent* pending = fFreeEvents.back();
+        fFreeEvents.pop_back();
+
+        pending->Initialize();
+        pending->SetEventInfo(sourceEvent);
+        Double_t time = sourceEvent->GetTime() + fSourceTimeOffsets[source];
+        pending->SetTime(time);
+
+        for (int n = 0; n < sourceEvent->GetNumberOfSignals(); n++) {
+            TRestRawSignal signal = *sourceEvent->GetSignal(n);
+            signal.SetSignalID(signal.GetSignalID() + fSourceIdOffsets[source]);
+            pending->AddSignal(signal);
+        }
+
+        fQueue.push({time, fSerial++, source, pending});
+        fPending[source]++;
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function.
+///
+/// It takes the earliest event in the queue and merges the events of the
+/// other sources found inside the coincidence window. Each time an event is
+/// taken from the queue its source buffer is refilled, keeping the merge in
+/// time order.
+///
+TRestEvent* TRestRawMultiSourceToSignalProcess::ProcessEvent(TRestEvent* inputEvent) {
+    vector<PendingEvent> merged;
+    vector<PendingEvent> deferred;
+
+    while (!fQueue.empty()) {
+        merged.clear();
+        deferred.clear();
+
+        Double_t startTime = fQueue.top().time;
+        fContributing.assign(fSources.size(), false);
+
+        while (!fQueue.empty() && fQueue.top().time - startTime <= fCoincidenceWindow) {
+            PendingEvent pending = fQueue.top();
+            fQueue.pop();
+
+            if (fContributing[pending.source]) {
+                // A source contributes at most one event, the others wait for the next combined event
+                deferred.push_back(pending);
+            } else {
+                fContributing[pending.source] = true;
+                merged.push_back(pending);
+                fPending[pending.source]--;
+            }
+
+            FillSource(pending.source);
+        }
+
+        for (const auto& pending : deferred) fQueue.push(pending);
+
+        fSignalEvent->Initialize();
+
+        Int_t primary = -1;
+        Int_t mask = 0;
+        for (const auto& pending : merged) {
+            mask |= 1 << pending.source;
+            if (primary == -1 || pending.source < primary) {
+                primary = pending.source;
+                fSignalEvent->SetEventInfo(pending.event);
+            }
+            for (int n = 0; n < pending.event->GetNumberOfSignals(); n++)
+                fSignalEvent->AddSignal(*pending.event->GetSignal(n));
+            fSourceEvents[pending.source]++;
+            fFreeEvents.push_back(pending.event);
+        }
+        fSignalEvent->SetTime(startTime);
+
+        if (fRequirePrimary && primary != 0) {
+            fOrphanEvents++;
+            continue;
+        }
+
+        totalBytesReaded = GetTotalBytesRead();
+
+        SetObservableValue("nSources", (Int_t)merged.size());
+        SetObservableValue("sourcesMask", mask);
+
+        if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug) {
+            RESTDebug << "TRestRawMultiSourceToSignalProcess: event " << fSignalEvent->GetID()
+                      << " built from " << merged.size() << " sources (mask " << mask << ")" << RESTendl;
+        }
+
+        AddEvent();
+        return fSignalEvent;
+    }
+
+    return nullptr;
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the total number of bytes read by all the sources
+///
+Long64_t TRestRawMultiSourceToSignalProcess::GetTotalBytesRead() const {
+    Long64_t bytes = 0;
+    for (const auto& source : fSources) bytes += source->GetTotalBytesRead();
+    return bytes;
+}
+
+///////////////////////////////////////////////
+/// \brief It rewinds all the sources and fills again the time ordered queue
+///
+Bool_t TRestRawMultiSourceToSignalProcess::ResetEntry() {
+    InitProcess();
+    return true;
+}
+
+///////////////////////////////////////////////
+/// \brief It finalizes the sources and prints the statistics of the event
+/// building
+///
+void TRestRawMultiSourceToSignalProcess::EndProcess() {
+    for (const auto& source : fSources) source->EndProcess();
+
+    totalBytesReaded = GetTotalBytesRead();
+    TRestRawToSignalProcess::EndProcess();
+
+    for (size_t n = 0; n < fSourceEvents.size(); n++)
+        RESTInfo << this->GetName() << " : " << fSourceEvents[n] << " events merged from source " << n << " ("
+                 << fSourceTypes[n] << ")" << RESTendl;
+    if (fOrphanEvents > 0)
+        RESTInfo << this->GetName() << " : " << fOrphanEvents
+                 << " combined events discarded without primary source" << RESTendl;
+}
+
+///////////////////////////////////////////////
+/// \brief It empties the time ordered queue
+///
+void TRestRawMultiSourceToSignalProcess::ClearQueue() {
+    while (!fQueue.empty()) fQueue.pop();
+}
+
+///////////////////////////////////////////////
+/// \brief It closes the input files of the source decoders, and it deletes
+/// them and the buffered events
+///
+void TRestRawMultiSourceToSignalProcess::ClearSources() {
+    ClearQueue();
+
+    for (auto source : fSources) {
+        source->CloseInputFiles();
+        delete source;
+    }
+    fSources.clear();
+
+    for (auto event : fEventPool) delete event;
+    fEventPool.clear();
+    fFreeEvents.clear();
+    fSerial = 0;
+}
+
+///////////////////////////////////////////////
+/// \brief Prints on screen the process data members
+///
+void TRestRawMultiSourceToSignalProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Coincidence window : " << fCoincidenceWindow << " s" << RESTendl;
+    RESTMetadata << "Buffer depth : " << fBufferDepth << " events per source" << RESTendl;
+    RESTMetadata << "Primary source required : " << fRequirePrimary << RESTendl;
+    for (size_t n = 0; n < fSourceTypes.size(); n++) {
+        RESTMetadata << " ------------------------------------ " << RESTendl;
+        RESTMetadata << "Source " << n << " : " << fSourceTypes[n] << " (" << fSourceNames[n] << ")"
+                     << RESTendl;
+        RESTMetadata << "Files : " << (fSourceFiles[n].empty() ? "run input files" : fSourceFiles[n])
+                     << RESTendl;
+        RESTMetadata << "Signal id offset : " << fSourceIdOffsets[n] << RESTendl;
+        RESTMetadata << "Time offset : " << fSourceTimeOffsets[n] << " s" << RESTendl;
+        if (n < fSourceEvents.size()) RESTMetadata << "Events merged : " << fSourceEvents[n] << RESTendl;
+    }
+    if (fOrphanEvents > 0) RESTMetadata << "Discarded without primary : " << fOrphanEvents << RESTendl;
+
+    EndPrintProcess();
+}
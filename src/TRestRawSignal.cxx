@@ -53,6 +53,13 @@
 ///	2022-January: Added robust baseline calculation methods
 /// \author		Konrad Altenmüller
 ///
+/// 2026-October: Added FindPulses for multi-pulse (pile-up) identification, and
+///               sub-bin peak, threshold crossing and constant fraction timing, and
+///               Savitzky-Golay smoothing and derivative filters, median spike removal, and
+///               fractional time shift and decimation kernels, cropping with start bin, and
+///               linear calibration, and optional floating point samples, and kernels
+///               specialized for the fixed number of samples of the AGET electronics
+///
 /// \class TRestRawSignal
 ///
 /// <hr>
@@ -64,10 +71,188 @@
 #include <TMath.h>
 #include <TRandom3.h>
 
+#include "TRestRawFFT.h"
+
+#include <map>
+#include <mutex>
 #include <numeric>
+#include <tuple>
+#include <type_traits>
 
 using namespace std;
 
+namespace {
+/// The Lanczos (windowed-sinc) interpolation kernel with `a` lobes
+Double_t LanczosKernel(Double_t x, Int_t a) {
+    if (x == 0) return 1;
+    if (x <= -a || x >= a) return 0;
+    Double_t px = TMath::Pi() * x;
+    return a * TMath::Sin(px) * TMath::Sin(px / a) / (px * px);
+}
+
+/// The Savitzky-Golay coefficient tables already calculated, by (halfWindow, order, derivative)
+std::map<std::tuple<Int_t, Int_t, Int_t>, std::vector<Double_t>> gSavitzkyGolayTables;
+std::mutex gSavitzkyGolayMutex;
+
+/// The number of sub-bin steps of the precomputed fractional delay kernels
+constexpr Int_t kFractionalDelaySteps = 64;
+
+/// The coefficients of a fractional delay kernel for kFractionalDelaySteps + 1 fractions in [0, 1]
+struct FractionalDelayBank {
+    /// The offset, relative to the sample before the interpolated time, of the first tap
+    Int_t first;
+    /// The number of taps of the kernel
+    Int_t taps;
+    /// The coefficients, one row of taps for each fraction
+    std::vector<Float_t> coefficients;
+};
+
+/// The sinc kernel with 4 lobes and a Kaiser window with beta = 6
+Double_t KaiserSincKernel(Double_t x) {
+    const Double_t a = 4, beta = 6;
+    if (std::abs(x) >= a) return 0;
+    const Double_t sinc = x == 0 ? 1 : TMath::Sin(TMath::Pi() * x) / (TMath::Pi() * x);
+    return sinc * TMath::BesselI0(beta * TMath::Sqrt(1 - x * x / (a * a))) / TMath::BesselI0(beta);
+}
+
+/// The cubic convolution kernel of Keys, with a = -0.5
+Double_t CubicKernel(Double_t x) {
+    x = std::abs(x);
+    if (x <= 1) return (1.5 * x - 2.5) * x * x + 1;
+    if (x < 2) return ((-0.5 * x + 2.5) * x - 4) * x + 2;
+    return 0;
+}
+
+/// It calculates the fractional delay bank of the given kernel, normalized to unit gain
+FractionalDelayBank MakeFractionalDelayBank(Int_t first, Int_t taps, Double_t (*kernel)(Double_t)) {
+    FractionalDelayBank bank{first, taps, std::vector<Float_t>((kFractionalDelaySteps + 1) * taps)};
+    for (int r = 0; r <= kFractionalDelaySteps; r++) {
+        const Double_t fraction = (Double_t)r / kFractionalDelaySteps;
+        Double_t sum = 0;
+        for (int t = 0; t < taps; t++) sum += kernel(fraction - first - t);
+        for (int t = 0; t < taps; t++) bank.coefficients[r * taps + t] = kernel(fraction - first - t) / sum;
+    }
+    return bank;
+}
+
+/// The decimation filters already calculated, by decimation factor
+std::map<Int_t, std::vector<Double_t>> gDecimationFilters;
+std::mutex gDecimationMutex;
+
+/// The median of three values, using only min/max operations
+template <typename T>
+inline T Median3(T a, T b, T c) {
+    return std::max(std::min(a, b), std::min(std::max(a, b), c));
+}
+
+/// It rounds the value to the closest integer, saturated to the Short_t range
+inline Short_t RoundToShort(Double_t value) {
+    return (Short_t)std::min(std::max(std::floor(value + 0.5), -32768.), 32767.);
+}
+
+/// The number of samples acquired by the AGET and AFTER based electronics
+constexpr Int_t kAGETSamples = 512;
+
+/// It calls kernel(n), where n is given as a compile time constant when it is the number of samples of
+/// the AGET electronics, so that the loops of the kernel are fully unrolled and vectorized for the usual
+/// signals, and as a runtime value otherwise.
+template <typename Kernel>
+inline auto WithFixedSamples(Int_t n, Kernel&& kernel) {
+    if (n == kAGETSamples) return kernel(std::integral_constant<Int_t, kAGETSamples>());
+    return kernel(n);
+}
+
+/// It calls kernel(data, n) with the n samples of the signal starting at *from*, taken from the floating
+/// point data if they exist, or from the Short_t data otherwise. See WithFixedSamples.
+template <typename Kernel>
+inline auto WithSamples(const std::vector<Short_t>& shortData, const std::vector<Float_t>& floatData,
+                        Int_t from, Int_t n, Kernel&& kernel) {
+    return WithFixedSamples(n, [&](auto count) {
+        return floatData.empty() ? kernel(shortData.data() + from, count)
+                                 : kernel(floatData.data() + from, count);
+    });
+}
+
+/// The sum of the n values. Short_t samples are accumulated with integer arithmetic, which is exact and
+/// can be vectorized.
+template <typename T, typename Count>
+inline Double_t SumKernel(const T* data, Count n) {
+    std::conditional_t<std::is_integral<T>::value, Long64_t, Double_t> sum = 0;
+    for (int i = 0; i < n; i++) sum += data[i];
+    return sum;
+}
+
+/// The sum of the squared differences of the n values to the given mean
+template <typename T, typename Count>
+inline Double_t SquaredDeviationKernel(const T* data, Count n, Double_t mean) {
+    Double_t sum = 0;
+    for (int i = 0; i < n; i++) sum += (mean - data[i]) * (mean - data[i]);
+    return sum;
+}
+
+/// The position of the first maximum of the n values, with n > 0. The maximum is found first, as a
+/// reduction without branches, and then its position.
+template <typename T, typename Count>
+inline Int_t MaxBinKernel(const T* data, Count n) {
+    T max = data[0];
+    for (int i = 1; i < n; i++) max = std::max(max, data[i]);
+    Int_t bin = 0;
+    while (bin < n - 1 && data[bin] != max) bin++;
+    return bin;
+}
+
+/// The position of the first minimum of the n values, with n > 0
+template <typename T, typename Count>
+inline Int_t MinBinKernel(const T* data, Count n) {
+    T min = data[0];
+    for (int i = 1; i < n; i++) min = std::min(min, data[i]);
+    Int_t bin = 0;
+    while (bin < n - 1 && data[bin] != min) bin++;
+    return bin;
+}
+
+/// It returns true if any of the n values, baseline corrected, is over the threshold
+template <typename T, typename Count>
+inline Bool_t OverThresholdKernel(const T* data, Count n, Double_t baseLine, Double_t threshold) {
+    Bool_t over = false;
+    for (int i = 0; i < n; i++) over |= data[i] - baseLine > threshold;
+    return over;
+}
+
+/// The median spike removal of TRestRawSignal::RemoveSpikes, for any sample type
+template <typename T>
+Int_t RemoveSpikesKernel(T* data, Int_t nPoints, Double_t threshold, Int_t window) {
+    Int_t removed = 0;
+
+    // The original values of the previous points, since the previous data may be already replaced
+    T previous1 = data[0];
+    T previous2 = data[0];
+
+    for (int i = 0; i < nPoints; i++) {
+        const T current = data[i];
+        const T next1 = data[std::min(i + 1, nPoints - 1)];
+
+        T median;
+        if (window >= 5) {
+            const T next2 = data[std::min(i + 2, nPoints - 1)];
+            median = Median3(current, std::max(std::min(previous2, previous1), std::min(next1, next2)),
+                             std::min(std::max(previous2, previous1), std::max(next1, next2)));
+        } else {
+            median = Median3(previous1, current, next1);
+        }
+
+        const Bool_t spike = std::abs(current - median) > threshold;
+        data[i] = spike ? median : current;
+        removed += spike;
+
+        previous2 = previous1;
+        previous1 = current;
+    }
+
+    return removed;
+}
+}  // namespace
+
 ClassImp(TRestRawSignal);
 
 ///////////////////////////////////////////////
@@ -101,6 +286,7 @@ TRestRawSignal::~TRestRawSignal() {}
 ///
 void TRestRawSignal::Initialize() {
     fSignalData.clear();
+    fFloatData.clear();
     fPointsOverThreshold.clear();
     fSignalID = -1;
 
@@ -111,6 +297,8 @@ void TRestRawSignal::Initialize() {
 
     fBaseLine = 0;
     fBaseLineSigma = 0;
+
+    fStartBin = 0;
 }
 
 ///////////////////////////////////////////////
@@ -119,14 +307,116 @@ void TRestRawSignal::Initialize() {
 ///
 void TRestRawSignal::Reset() {
     Int_t nBins = GetNumberOfPoints();
+    Int_t startBin = fStartBin;
+    Bool_t isFloat = IsFloat();
     Initialize();
-    fSignalData.resize(nBins, 0);
+    if (isFloat) {
+        fFloatData.resize(nBins, 0);
+    } else {
+        fSignalData.resize(nBins, 0);
+    }
+    fStartBin = startBin;
 }
 
 ///////////////////////////////////////////////
 /// \brief Adds a new point to the end of the signal data array
 ///
-void TRestRawSignal::AddPoint(Short_t d) { fSignalData.push_back(d); }
+void TRestRawSignal::AddPoint(Short_t d) {
+    if (IsFloat()) {
+        fFloatData.push_back(d);
+    } else {
+        fSignalData.push_back(d);
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief Adds the given values to the end of the signal data array, as it is
+/// done by the raw data decoders. The values are converted to Short_t in a
+/// single pass, which is specialized for the number of samples of the AGET
+/// electronics.
+///
+void TRestRawSignal::AddPoints(const Int_t* data, Int_t nPoints) {
+    if (nPoints <= 0) return;
+
+    if (IsFloat()) {
+        fFloatData.insert(fFloatData.end(), data, data + nPoints);
+        return;
+    }
+
+    const size_t first = fSignalData.size();
+    fSignalData.resize(first + nPoints);
+    Short_t* signalData = fSignalData.data() + first;
+    WithFixedSamples(nPoints, [&](auto n) {
+        for (int i = 0; i < n; i++) signalData[i] = (Short_t)data[i];
+    });
+}
+
+///////////////////////////////////////////////
+/// \brief Adds a new point to the end of the signal data array, with the given
+/// value rounded to the closest integer and saturated to the Short_t range.
+///
+void TRestRawSignal::AddRoundedPoint(Double_t d) { AddPoint(RoundToShort(d)); }
+
+///////////////////////////////////////////////
+/// \brief Adds a new floating point value to the end of the signal data array.
+///
+/// The signal is converted to floating point samples (see ConvertToFloat) if it
+/// was not already.
+///
+void TRestRawSignal::AddFloatPoint(Float_t d) {
+    ConvertToFloat();
+    fFloatData.push_back(d);
+}
+
+///////////////////////////////////////////////
+/// \brief It replaces the signal data by the given floating point values.
+///
+void TRestRawSignal::SetFloatData(const std::vector<Float_t>& data) {
+    fFloatData = data;
+    fSignalData.clear();
+}
+
+///////////////////////////////////////////////
+/// \brief It places the signal values at the given vector, as floating point
+/// values, independently of the sample type of the signal. No baseline
+/// correction is applied.
+///
+void TRestRawSignal::GetFloatData(std::vector<Float_t>& data) const {
+    if (IsFloat()) {
+        data = fFloatData;
+    } else {
+        data.assign(fSignalData.begin(), fSignalData.end());
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief It stores the signal values as floating point values, so that the
+/// processes modifying the signal, as the calibration or the filters, keep
+/// the fractional part of the results.
+///
+/// The values are then stored only as floating point values, and the Short_t
+/// data are left empty. The methods reading a Short_t value, as operator[],
+/// round the floating point value to the closest integer. The signal can be
+/// converted back with ConvertToShort.
+///
+void TRestRawSignal::ConvertToFloat() {
+    if (IsFloat()) return;
+    fFloatData.assign(fSignalData.begin(), fSignalData.end());
+    fSignalData.clear();
+}
+
+///////////////////////////////////////////////
+/// \brief It stores the signal values as Short_t values, rounded to the
+/// closest integer and saturated to the Short_t range, and it removes the
+/// floating point values.
+///
+void TRestRawSignal::ConvertToShort() {
+    if (!IsFloat()) return;
+    fSignalData.resize(fFloatData.size());
+    for (size_t i = 0; i < fFloatData.size(); i++) fSignalData[i] = RoundToShort(fFloatData[i]);
+    fFloatData.clear();
+    fFloatData.shrink_to_fit();
+}
 
 ///////////////////////////////////////////////
 /// \brief Adds a new point to the end of the signal data array. Same as
@@ -154,6 +444,7 @@ Short_t TRestRawSignal::operator[](Int_t n) {
         }
         return 0xFFFF;
     }
+    if (IsFloat()) return RoundToShort(fFloatData[n]);
     return fSignalData[n];
 }
 
@@ -166,13 +457,17 @@ Short_t TRestRawSignal::operator[](Int_t n) {
 /// been called previously, this
 /// method will return the raw values inside fSignalData.
 ///
-Double_t TRestRawSignal::GetData(Int_t n) const { return (Double_t)fSignalData[n] - fBaseLine; }
+/// For floating point signals, the floating point value is returned.
+///
+Double_t TRestRawSignal::GetData(Int_t n) const { return GetRawData(n) - fBaseLine; }
 
 ///////////////////////////////////////////////
 /// \brief It returns the original data value of point *n* without baseline
 /// correction.
 ///
-Double_t TRestRawSignal::GetRawData(Int_t n) const { return (Double_t)fSignalData[n]; }
+Double_t TRestRawSignal::GetRawData(Int_t n) const {
+    return IsFloat() ? (Double_t)fFloatData[n] : (Double_t)fSignalData[n];
+}
 
 ///////////////////////////////////////////////
 /// \brief It adds the content of data to fSignalData[bin].
@@ -188,6 +483,11 @@ void TRestRawSignal::IncreaseBinBy(Int_t bin, Double_t data) {
         return;
     }
 
+    if (IsFloat()) {
+        fFloatData[bin] += data;
+        return;
+    }
+
     fSignalData[bin] += data;
 }
 
@@ -231,6 +531,18 @@ void TRestRawSignal::InitializePointsOverThreshold(const TVector2& thrPar, Int_t
 
     double threshold = pointTh * fBaseLineSigma;
 
+    // Most signals contain only noise, and they are rejected with a single pass over the data
+    const Int_t from = fRange.X();
+    const Int_t to = std::min((Int_t)fRange.Y(), GetNumberOfPoints());
+    const Double_t baseLine = fBaseLine;
+    auto overThreshold = [&](const auto* data, auto n) {
+        return OverThresholdKernel(data, n, baseLine, threshold);
+    };
+    if (to <= from || !WithSamples(fSignalData, fFloatData, from, to - from, overThreshold)) {
+        CalculateThresholdIntegral();
+        return;
+    }
+
     for (int i = fRange.X(); i < fRange.Y(); i++) {
         // Filling a pulse with consecutive points that are over threshold
         if (this->GetData(i) > threshold) {
@@ -487,21 +799,173 @@ Double_t TRestRawSignal::GetMaxPeakValue() { return GetData(GetMaxPeakBin()); }
 /// \brief It returns the bin at which the maximum peak amplitude happens
 ///
 Int_t TRestRawSignal::GetMaxPeakBin() {
-    Double_t max = numeric_limits<Double_t>::min();
-
-    Int_t index = 0;
-
     if (fRange.Y() == 0 || fRange.Y() > GetNumberOfPoints()) fRange.SetY(GetNumberOfPoints());
     if (fRange.X() < 0) fRange.SetX(0);
 
-    for (int i = fRange.X(); i < fRange.Y(); i++) {
-        if (this->GetData(i) > max) {
-            max = GetData(i);
-            index = i;
+    const Int_t from = fRange.X();
+    const Int_t to = fRange.Y();
+    if (to <= from) return 0;
+
+    Int_t index = from + WithSamples(fSignalData, fFloatData, from, to - from,
+                                     [](const auto* data, auto n) { return MaxBinKernel(data, n); });
+
+    // Only a positive maximum, after baseline correction, is considered
+    if (GetData(index) > numeric_limits<Double_t>::min()) return index;
+    return 0;
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the position, in bins, of the maximum of the signal with
+/// sub-bin precision.
+///
+/// The maximum bin is obtained from GetMaxPeakBin and refined using the
+/// neighbour points, see GetMaxPeakTime(Int_t, const std::string&).
+///
+Double_t TRestRawSignal::GetMaxPeakTime(const std::string& option) {
+    Int_t bin = GetMaxPeakBin();
+
+    if (bin <= fRange.X() || bin >= fRange.Y() - 1) return bin;
+
+    return GetMaxPeakTime(bin, option);
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the position, in bins, of the maximum of the signal
+/// found at the given bin, as the maximum of a pulse, with sub-bin precision.
+///
+/// The bin is refined using the neighbour points. The following options are
+/// available:
+/// * **PARABOLIC** (default): the vertex of the parabola passing through the
+/// maximum bin and its two neighbours.
+/// * **GAUSSIAN**: the vertex of the parabola passing through the logarithm of
+/// the same three points, which is exact for gaussian shaped pulses. PARABOLIC
+/// is used if any of the three values is not positive.
+/// * **SINC**: the maximum of the Lanczos (windowed-sinc) interpolation of the
+/// signal, evaluated in steps of 1/16 bin around the maximum bin and refined
+/// with a parabola.
+///
+/// The bin is returned if it is the first or the last data point.
+///
+Double_t TRestRawSignal::GetMaxPeakTime(Int_t bin, const std::string& option) const {
+    if (bin <= 0 || bin >= GetNumberOfPoints() - 1) return bin;
+
+    Double_t y0 = GetData(bin - 1);
+    Double_t y1 = GetData(bin);
+    Double_t y2 = GetData(bin + 1);
+
+    string opt = ToUpper(option);
+    if (opt == "SINC") {
+        const Int_t lobes = 3;
+        const Int_t steps = 16;
+        auto interpolate = [&](Double_t x) {
+            // The kernel weights are normalized to preserve the local signal level
+            Double_t value = 0;
+            Double_t weight = 0;
+            for (int k = (Int_t)TMath::Floor(x) - lobes + 1; k <= (Int_t)TMath::Floor(x) + lobes; k++) {
+                if (k < 0 || k >= GetNumberOfPoints()) continue;
+                Double_t w = LanczosKernel(x - k, lobes);
+                value += GetData(k) * w;
+                weight += w;
+            }
+            return value / weight;
+        };
+
+        Double_t best = bin;
+        Double_t bestValue = y1;
+        for (int n = -steps; n <= steps; n++) {
+            Double_t x = bin + (Double_t)n / steps;
+            Double_t value = interpolate(x);
+            if (value > bestValue) {
+                best = x;
+                bestValue = value;
+            }
+        }
+
+        y0 = interpolate(best - 1. / steps);
+        y2 = interpolate(best + 1. / steps);
+        Double_t den = y0 - 2 * bestValue + y2;
+        if (den >= 0) return best;
+        return best + 0.5 * (y0 - y2) / den / steps;
+    }
+
+    if (opt == "GAUSSIAN" && y0 > 0 && y1 > 0 && y2 > 0) {
+        y0 = TMath::Log(y0);
+        y1 = TMath::Log(y1);
+        y2 = TMath::Log(y2);
+    }
+
+    Double_t den = y0 - 2 * y1 + y2;
+    if (den >= 0) return bin;
+
+    return bin + 0.5 * (y0 - y2) / den;
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the time, in bins, at which the signal crosses the given
+/// threshold on the leading edge of the maximum peak, linearly interpolated
+/// between the two bins around the crossing.
+///
+/// The signal is followed backwards from the maximum bin, so that baseline
+/// fluctuations before the pulse do not affect the result. It returns -1 if
+/// the maximum is below the threshold.
+///
+Double_t TRestRawSignal::GetThresholdCrossingTime(Double_t threshold) {
+    Int_t bin = GetMaxPeakBin();
+
+    if (GetData(bin) < threshold) return -1;
+
+    while (bin > fRange.X() && GetData(bin - 1) >= threshold) bin--;
+
+    if (bin == fRange.X()) return bin;
+
+    Double_t before = GetData(bin - 1);
+    Double_t after = GetData(bin);
+
+    return bin - 1 + (threshold - before) / (after - before);
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the time, in bins, obtained with a digital constant
+/// fraction discriminator.
+///
+/// If *delay* is not positive, it returns the time at which the leading edge
+/// of the maximum peak crosses *fraction* times the peak amplitude, see
+/// GetThresholdCrossingTime.
+///
+/// Otherwise, the classical constant fraction signal is built as the signal
+/// delayed by *delay* bins minus *fraction* times the signal, and the time is
+/// given by its zero crossing, following its minimum, linearly interpolated.
+/// It returns -1 if no crossing is found.
+///
+Double_t TRestRawSignal::GetConstantFractionTime(Double_t fraction, Int_t delay) {
+    Int_t peakBin = GetMaxPeakBin();
+    Double_t amplitude = GetData(peakBin);
+
+    if (amplitude <= 0) return -1;
+
+    if (delay <= 0) return GetThresholdCrossingTime(fraction * amplitude);
+
+    auto cfd = [&](Int_t i) { return (i - delay >= 0 ? GetData(i - delay) : 0) - fraction * GetData(i); };
+
+    Int_t last = TMath::Min(peakBin + delay, (Int_t)fRange.Y() - 1);
+
+    Int_t minBin = (Int_t)fRange.X();
+    Double_t minValue = cfd(minBin);
+    for (int i = minBin + 1; i <= last; i++) {
+        Double_t value = cfd(i);
+        if (value < minValue) {
+            minValue = value;
+            minBin = i;
         }
     }
 
-    return index;
+    for (int i = minBin; i < last; i++) {
+        Double_t before = cfd(i);
+        Double_t after = cfd(i + 1);
+        if (before < 0 && after >= 0) return i - before / (after - before);
+    }
+
+    return -1;
 }
 
 ///////////////////////////////////////////////
@@ -515,20 +979,15 @@ Double_t TRestRawSignal::GetMinPeakValue() { return GetData(GetMinPeakBin()); }
 /// \brief It returns the bin at which the minimum peak amplitude happens
 ///
 Int_t TRestRawSignal::GetMinPeakBin() {
-    Double_t min = numeric_limits<Double_t>::max();
-    Int_t index = 0;
-
     if (fRange.Y() == 0 || fRange.Y() > GetNumberOfPoints()) fRange.SetY(GetNumberOfPoints());
     if (fRange.X() < 0) fRange.SetX(0);
 
-    for (int i = fRange.X(); i < fRange.Y(); i++) {
-        if (this->GetData(i) < min) {
-            min = GetData(i);
-            index = i;
-        }
-    }
+    const Int_t from = fRange.X();
+    const Int_t to = fRange.Y();
+    if (to <= from) return 0;
 
-    return index;
+    return from + WithSamples(fSignalData, fFloatData, from, to - from,
+                              [](const auto* data, auto n) { return MinBinKernel(data, n); });
 }
 
 ///////////////////////////////////////////////
@@ -538,12 +997,12 @@ Bool_t TRestRawSignal::IsADCSaturation(int Nflat) {
     if (Nflat <= 0) return false;
     // GetMaxPeakBin() will always find the first max peak bin if multiple bins are in same max value.
     int index = GetMaxPeakBin();
-    Short_t value = fSignalData[index];
+    Double_t value = GetRawData(index);
 
     bool sat = false;
-    if (index + Nflat <= (int)fSignalData.size()) {
+    if (index + Nflat <= GetNumberOfPoints()) {
         for (int i = index; i < index + Nflat; i++) {
-            if (fSignalData[i] != value) {
+            if (GetRawData(i) != value) {
                 break;
             }
             if (i == index + Nflat - 1) {
@@ -555,6 +1014,86 @@ Bool_t TRestRawSignal::IsADCSaturation(int Nflat) {
     return sat;
 }
 
+///////////////////////////////////////////////
+/// \brief It identifies the individual pulses found at the points over
+/// threshold, as in the case of pile-up, and it fills the *pulses* vector
+/// with the bins, amplitude and integral of each of them. It returns the
+/// number of pulses found.
+///
+/// InitializePointsOverThreshold must be called before. Each group of
+/// consecutive points over threshold is scanned once following the sign
+/// changes of the signal derivative. A maximum defines a new pulse once the
+/// signal drops more than *hysteresis* (in ADC units) below it, and the next
+/// pulse starts at the minimum found afterwards, once the signal rises again
+/// more than *hysteresis* above it. A few times the baseline sigma is a
+/// reasonable choice for *hysteresis*.
+///
+/// The vector is cleared but its capacity is preserved, so that no memory is
+/// allocated when the same vector is reused for all the signals.
+///
+Int_t TRestRawSignal::FindPulses(std::vector<Pulse>& pulses, Double_t hysteresis) {
+    pulses.clear();
+
+    if (hysteresis < 0) hysteresis = 0;
+
+    const size_t nPoints = fPointsOverThreshold.size();
+    size_t n = 0;
+    while (n < nPoints) {
+        // The limits of a group of consecutive points over threshold
+        size_t last = n;
+        while (last + 1 < nPoints && fPointsOverThreshold[last + 1] == fPointsOverThreshold[last] + 1) last++;
+        const Int_t from = fPointsOverThreshold[n];
+        const Int_t to = fPointsOverThreshold[last] + 1;
+        n = last + 1;
+
+        Pulse pulse = {from, to, from, GetData(from), 0};
+        Bool_t rising = true;
+        Int_t valleyBin = from;
+        Double_t valley = 0;
+        Double_t sum = 0;
+        Double_t sumAtValley = 0;
+
+        for (int i = from; i < to; i++) {
+            Double_t value = GetData(i);
+
+            if (rising) {
+                if (value > pulse.amplitude) {
+                    pulse.peakBin = i;
+                    pulse.amplitude = value;
+                } else if (value < pulse.amplitude - hysteresis) {
+                    rising = false;
+                    valleyBin = i;
+                    valley = value;
+                    sumAtValley = sum;
+                }
+            } else if (value < valley) {
+                valleyBin = i;
+                valley = value;
+                sumAtValley = sum;
+            } else if (value > valley + hysteresis) {
+                // A new pulse starts at the valley
+                pulse.end = valleyBin;
+                pulse.integral = sumAtValley;
+                pulses.push_back(pulse);
+
+                sum -= sumAtValley;
+                pulse.start = valleyBin;
+                pulse.peakBin = i;
+                pulse.amplitude = value;
+                rising = true;
+            }
+
+            sum += value;
+        }
+
+        pulse.end = to;
+        pulse.integral = sum;
+        pulses.push_back(pulse);
+    }
+
+    return pulses.size();
+}
+
 ///////////////////////////////////////////////
 /// \brief It calculates the differential signal of the existing signal and it
 /// will place at the
@@ -567,6 +1106,7 @@ Bool_t TRestRawSignal::IsADCSaturation(int Nflat) {
 void TRestRawSignal::GetDifferentialSignal(TRestRawSignal* diffSignal, Int_t smearPoints) {
     if (smearPoints <= 0) smearPoints = 1;
     diffSignal->Initialize();
+    diffSignal->SetStartBin(fStartBin);
 
     for (int i = 0; i < smearPoints; i++) diffSignal->AddPoint(0);
 
@@ -593,6 +1133,7 @@ void TRestRawSignal::GetWhiteNoiseSignal(TRestRawSignal* noiseSignal, Double_t n
     delete dd;
     TRandom3* fRandom = new TRandom3(seed);
 
+    noiseSignal->SetStartBin(fStartBin);
     for (int i = 0; i < GetNumberOfPoints(); i++) {
         noiseSignal->AddPoint(this->GetData(i) + (Short_t)fRandom->Gaus(0, noiseLevel));
     }
@@ -608,6 +1149,7 @@ void TRestRawSignal::GetWhiteNoiseSignal(TRestRawSignal* noiseSignal, Double_t n
 ///
 void TRestRawSignal::GetSignalSmoothed(TRestRawSignal* smoothedSignal, Int_t averagingPoints) {
     smoothedSignal->Initialize();
+    smoothedSignal->SetStartBin(fStartBin);
 
     averagingPoints = (averagingPoints / 2) * 2 + 1;  // make it odd >= averagingPoints
 
@@ -632,7 +1174,8 @@ void TRestRawSignal::GetSignalSmoothed(TRestRawSignal* smoothedSignal, Int_t ave
 /// points used to average the signal
 ///
 /// \param option If the option is set to "EXCLUDE OUTLIERS", points that are too far away from the median
-/// baseline will be ignored to improve the smoothing result
+/// baseline will be ignored to improve the smoothing result. If it is set to "SAVITZKY-GOLAY", a second
+/// order Savitzky-Golay filter is used instead of the moving average, preserving the pulse height and width.
 ///
 std::vector<Float_t> TRestRawSignal::GetSignalSmoothed(Int_t averagingPoints, std::string option) {
     std::vector<Float_t> result;
@@ -656,6 +1199,8 @@ std::vector<Float_t> TRestRawSignal::GetSignalSmoothed(Int_t averagingPoints, st
             result[i] = sumAvg;
     } else if (ToUpper(option) == "EXCLUDE OUTLIERS") {
         result = GetSignalSmoothed_ExcludeOutliers(averagingPoints);
+    } else if (ToUpper(option) == "SAVITZKY-GOLAY") {
+        GetSignalSavitzkyGolay(result, averagingPoints / 2, 2);
     } else {
         cout << "TRestRawSignal::GetSignalSmoothed. Error! No such option!" << endl;
     }
@@ -700,6 +1245,310 @@ std::vector<Float_t> TRestRawSignal::GetSignalSmoothed_ExcludeOutliers(Int_t ave
     return result;
 }
 
+///////////////////////////////////////////////
+/// \brief It returns the Savitzky-Golay convolution coefficients for a window of 2*halfWindow+1 points.
+///
+/// The coefficients result from the least squares fit of a polynomial of the given order to the points
+/// of the window, and evaluate the requested derivative of that polynomial at the central point, in
+/// ADC units per bin^derivative. The coefficients are calculated only the first time a combination of
+/// parameters is requested, and they are kept afterwards so that they can be reused by any signal.
+///
+/// An empty vector is returned if the parameters are not valid, i.e. the polynomial order must be smaller
+/// than the number of points in the window and the derivative cannot be higher than the polynomial order.
+///
+const std::vector<Double_t>& TRestRawSignal::GetSavitzkyGolayCoefficients(Int_t halfWindow, Int_t order,
+                                                                          Int_t derivative) {
+    std::lock_guard<std::mutex> lock(gSavitzkyGolayMutex);
+
+    auto key = std::make_tuple(halfWindow, order, derivative);
+    auto it = gSavitzkyGolayTables.find(key);
+    if (it != gSavitzkyGolayTables.end()) return it->second;
+
+    std::vector<Double_t>& coefficients = gSavitzkyGolayTables[key];
+    if (halfWindow < 0 || order < 0 || order >= 2 * halfWindow + 1 || derivative < 0 || derivative > order) {
+        cout << "TRestRawSignal::GetSavitzkyGolayCoefficients. Error! Invalid window " << 2 * halfWindow + 1
+             << ", order " << order << " and derivative " << derivative << endl;
+        return coefficients;
+    }
+
+    // Normal equations (A^T A) x = e_derivative, with A(j,k) = j^k for j in [-halfWindow, halfWindow]
+    const Int_t n = order + 1;
+    std::vector<Double_t> powerSums(2 * order + 1, 0);
+    for (int j = -halfWindow; j <= halfWindow; j++) {
+        Double_t p = 1;
+        for (int k = 0; k <= 2 * order; k++, p *= j) powerSums[k] += p;
+    }
+
+    std::vector<std::vector<Double_t>> m(n, std::vector<Double_t>(n + 1, 0));
+    for (int r = 0; r < n; r++) {
+        for (int c = 0; c < n; c++) m[r][c] = powerSums[r + c];
+        m[r][n] = (r == derivative) ? 1 : 0;
+    }
+
+    // Gauss-Jordan elimination with partial pivoting
+    for (int c = 0; c < n; c++) {
+        int pivot = c;
+        for (int r = c + 1; r < n; r++)
+            if (std::abs(m[r][c]) > std::abs(m[pivot][c])) pivot = r;
+        std::swap(m[c], m[pivot]);
+        for (int r = 0; r < n; r++) {
+            if (r == c) continue;
+            Double_t f = m[r][c] / m[c][c];
+            for (int k = c; k <= n; k++) m[r][k] -= f * m[c][k];
+        }
+    }
+
+    Double_t factorial = 1;
+    for (int k = 2; k <= derivative; k++) factorial *= k;
+
+    // The coefficient of point j is the fitted derivative response, d! * sum_k x_k j^k
+    coefficients.resize(2 * halfWindow + 1);
+    for (int j = -halfWindow; j <= halfWindow; j++) {
+        Double_t value = 0, p = 1;
+        for (int k = 0; k < n; k++, p *= j) value += m[k][n] / m[k][k] * p;
+        coefficients[j + halfWindow] = factorial * value;
+    }
+
+    return coefficients;
+}
+
+///////////////////////////////////////////////
+/// \brief It applies a Savitzky-Golay filter to the raw data and places the result in the given vector.
+///
+/// Unlike a moving average, the Savitzky-Golay filter preserves the moments of the pulse up to the
+/// polynomial order, so that the amplitude and width of the pulses are not degraded by the smoothing.
+/// When derivative > 0 the derivative of the signal is obtained instead, which is less sensitive to noise
+/// than the difference between consecutive points. The signal is extended at the edges by repeating the
+/// first and last points.
+///
+/// \param result The vector where the filtered signal is placed. It is resized to the number of points.
+///
+/// \param halfWindow The number of points at each side of the central point used by the filter
+///
+/// \param order The order of the polynomial fitted to the points of the window
+///
+/// \param derivative The order of the derivative returned. If 0, the signal is smoothed.
+///
+void TRestRawSignal::GetSignalSavitzkyGolay(std::vector<Float_t>& result, Int_t halfWindow, Int_t order,
+                                            Int_t derivative) {
+    const Int_t nPoints = GetNumberOfPoints();
+    result.assign(nPoints, 0);
+
+    const std::vector<Double_t>& coefficients = GetSavitzkyGolayCoefficients(halfWindow, order, derivative);
+    if (coefficients.empty() || nPoints == 0) return;
+
+    // The same kernel is used for Short_t and floating point samples
+    auto convolve = [&](const auto* data) {
+        // Points in the middle, accumulated one coefficient at a time over the whole range
+        const Int_t first = std::min(halfWindow, nPoints);
+        const Int_t last = std::max(first, nPoints - halfWindow);
+        for (int j = -halfWindow; j <= halfWindow; j++) {
+            const Float_t c = coefficients[j + halfWindow];
+            for (int i = first; i < last; i++) result[i] += c * data[i + j];
+        }
+
+        // Points at the edges, where the first and last points are repeated
+        for (int i = 0; i < nPoints; i++) {
+            if (i == first) i = last;
+            if (i >= nPoints) break;
+            Double_t value = 0;
+            for (int j = -halfWindow; j <= halfWindow; j++)
+                value += coefficients[j + halfWindow] * data[std::min(std::max(i + j, 0), nPoints - 1)];
+            result[i] = value;
+        }
+    };
+
+    if (IsFloat()) {
+        convolve(fFloatData.data());
+    } else {
+        convolve(fSignalData.data());
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief It shifts the raw data in time by a fraction of a bin, and places the result in the given vector.
+///
+/// The point *i* of the result is the signal interpolated at the time *i - shift*, so that a positive shift
+/// delays the signal. The following interpolation options are available:
+/// * **SINC** (default): a sinc kernel with 8 taps and a Kaiser window.
+/// * **CUBIC**: the cubic convolution kernel of Keys, with 4 taps.
+/// * **FFT**: a phase shift of the signal spectrum, exact for band limited signals. The signal is treated as
+/// periodic, so that the points shifted out at one edge appear at the other one.
+///
+/// The SINC and CUBIC kernels are precomputed for 64 fractions of a bin, and the fraction is rounded to the
+/// closest one. The same kernel is used for every point, and the points outside the signal are taken from
+/// the first and last points.
+///
+/// \param result The vector where the shifted signal is placed. It is resized to the number of points.
+///
+/// \param shift The time shift, in bins
+///
+/// \param option The interpolation kernel, SINC, CUBIC or FFT
+///
+void TRestRawSignal::GetSignalShifted(std::vector<Float_t>& result, Double_t shift,
+                                      const std::string& option) {
+    const Int_t nPoints = GetNumberOfPoints();
+    result.assign(nPoints, 0);
+    if (nPoints == 0) return;
+
+    if (ToUpper(option) == "FFT") {
+        TRestRawFFT fft;
+        fft.ForwardSignalFFT(this);
+        for (int k = 0; 2 * k <= nPoints; k++) {
+            const Double_t phase = -2 * TMath::Pi() * k * shift / nPoints;
+            const Double_t re = fft.GetFrequencyAmplitudeReal(k);
+            const Double_t im = fft.GetFrequencyAmplitudeImg(k);
+            Double_t shiftedRe = re * TMath::Cos(phase) - im * TMath::Sin(phase);
+            Double_t shiftedIm = re * TMath::Sin(phase) + im * TMath::Cos(phase);
+            // The Nyquist frequency of a real signal must remain real
+            if (2 * k == nPoints) shiftedIm = 0;
+            fft.SetNode(k, shiftedRe, shiftedIm);
+            if (k > 0 && 2 * k < nPoints) fft.SetNode(nPoints - k, shiftedRe, -shiftedIm);
+        }
+        fft.BackwardFFT();
+        for (int i = 0; i < nPoints; i++) result[i] = fft.GetTimeAmplitudeReal(i) + fBaseLine;
+        return;
+    }
+
+    static const FractionalDelayBank sincBank = MakeFractionalDelayBank(-3, 8, KaiserSincKernel);
+    static const FractionalDelayBank cubicBank = MakeFractionalDelayBank(-1, 4, CubicKernel);
+
+    const FractionalDelayBank* bank = &sincBank;
+    if (ToUpper(option) == "CUBIC") {
+        bank = &cubicBank;
+    } else if (option != "" && ToUpper(option) != "SINC") {
+        cout << "TRestRawSignal::GetSignalShifted. Error! No such option : " << option << endl;
+        return;
+    }
+
+    // The point i is interpolated between i + offset and i + offset + 1, at the given fraction
+    Int_t offset = (Int_t)TMath::Floor(-shift);
+    Int_t step = TMath::Nint((-shift - offset) * kFractionalDelaySteps);
+    if (step == kFractionalDelaySteps) {
+        step = 0;
+        offset++;
+    }
+
+    const Int_t first = offset + bank->first;
+    const Int_t taps = bank->taps;
+    const Float_t* coefficients = bank->coefficients.data() + step * taps;
+
+    // The same kernel is used for Short_t and floating point samples
+    auto interpolate = [&](const auto* data) {
+        // Points in the middle, accumulated one tap at a time over the whole range
+        const Int_t from = std::min(std::max(-first, 0), nPoints);
+        const Int_t to = std::max(from, std::min(nPoints - first - taps + 1, nPoints));
+        for (int t = 0; t < taps; t++) {
+            const Float_t c = coefficients[t];
+            const Int_t lag = first + t;
+            for (int i = from; i < to; i++) result[i] += c * data[i + lag];
+        }
+
+        // Points at the edges, where the first and last points are repeated
+        for (int i = 0; i < nPoints; i++) {
+            if (i == from) i = to;
+            if (i >= nPoints) break;
+            Double_t value = 0;
+            for (int t = 0; t < taps; t++)
+                value += coefficients[t] * data[std::min(std::max(i + first + t, 0), nPoints - 1)];
+            result[i] = value;
+        }
+    };
+
+    if (IsFloat()) {
+        interpolate(fFloatData.data());
+    } else {
+        interpolate(fSignalData.data());
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief It reduces the number of points of the signal by the given factor, and places the result in the
+/// given vector.
+///
+/// The point *k* of the result corresponds to the center of the bins from *k * factor* to
+/// *(k + 1) * factor - 1* of the original signal. The number of points of the result is the number of
+/// points of the signal divided by the factor, and the remaining points are ignored. The following options
+/// are available:
+/// * **SINC** (default): the signal is filtered, before it is decimated, with a Lanczos windowed-sinc
+/// low-pass filter with cut-off at the new Nyquist frequency, which suppresses the aliasing of the high
+/// frequency noise. The filter is calculated once for each factor.
+/// * **AVERAGE**: each point is the average of the original bins it contains, preserving the integral of
+/// the signal.
+///
+/// \param result The vector where the decimated signal is placed
+///
+/// \param factor The number of original bins in each bin of the result
+///
+/// \param option The decimation method, SINC or AVERAGE
+///
+void TRestRawSignal::GetSignalDecimated(std::vector<Float_t>& result, Int_t factor,
+                                        const std::string& option) {
+    const Int_t nPoints = GetNumberOfPoints();
+    if (factor < 1) {
+        cout << "TRestRawSignal::GetSignalDecimated. Error! The factor must be positive" << endl;
+        result.clear();
+        return;
+    }
+
+    const Int_t nDecimated = nPoints / factor;
+    result.assign(nDecimated, 0);
+
+    if (ToUpper(option) == "AVERAGE") {
+        auto average = [&](const auto* data) {
+            for (int j = 0; j < factor; j++)
+                for (int k = 0; k < nDecimated; k++) result[k] += data[k * factor + j];
+        };
+        if (IsFloat()) {
+            average(fFloatData.data());
+        } else {
+            average(fSignalData.data());
+        }
+        for (int k = 0; k < nDecimated; k++) result[k] /= factor;
+        return;
+    } else if (option != "" && ToUpper(option) != "SINC") {
+        cout << "TRestRawSignal::GetSignalDecimated. Error! No such option : " << option << endl;
+        return;
+    }
+
+    // The filter taps are placed at the distances (q - (factor - 1) / 2) from the center of the new bin,
+    // with q = first, ..., first + taps - 1, relative to the first original bin.
+    const Int_t first = (Int_t)TMath::Ceil((factor - 1) / 2. - 3 * factor);
+    const vector<Double_t>* filter = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(gDecimationMutex);
+        vector<Double_t>& coefficients = gDecimationFilters[factor];
+        if (coefficients.empty()) {
+            for (int q = first; q - (factor - 1) / 2. < 3 * factor; q++)
+                coefficients.push_back(LanczosKernel((q - (factor - 1) / 2.) / factor, 3));
+            const Double_t sum = std::accumulate(coefficients.begin(), coefficients.end(), 0.);
+            for (auto& c : coefficients) c /= sum;
+        }
+        filter = &coefficients;
+    }
+
+    const Int_t taps = filter->size();
+    auto decimate = [&](const auto* data) {
+        for (int k = 0; k < nDecimated; k++) {
+            const Int_t start = k * factor + first;
+            Double_t value = 0;
+            if (start >= 0 && start + taps <= nPoints) {
+                for (int t = 0; t < taps; t++) value += (*filter)[t] * data[start + t];
+            } else {
+                for (int t = 0; t < taps; t++)
+                    value += (*filter)[t] * data[std::min(std::max(start + t, 0), nPoints - 1)];
+            }
+            result[k] = value;
+        }
+    };
+
+    if (IsFloat()) {
+        decimate(fFloatData.data());
+    } else {
+        decimate(fSignalData.data());
+    }
+}
+
 ///////////////////////////////////////////////
 /// \brief It applies the moving average filter (GetSignalSmoothed) to the signal, which is then subtracted
 /// from the raw data, resulting in a corrected baseline. The returned signal is placed at the signal pointer
@@ -710,31 +1559,44 @@ std::vector<Float_t> TRestRawSignal::GetSignalSmoothed_ExcludeOutliers(Int_t ave
 /// \param averagingPoints It defines the number of neighbour consecutive
 /// points used to average the signal
 ///
+/// The corrected signal has floating point samples if this signal has them.
+///
 void TRestRawSignal::GetBaseLineCorrected(TRestRawSignal* smoothedSignal, Int_t averagingPoints) {
     smoothedSignal->Initialize();
+    smoothedSignal->SetStartBin(fStartBin);
 
     std::vector<Float_t> averagedSignal = GetSignalSmoothed(averagingPoints, "EXCLUDE OUTLIERS");
 
     for (int i = 0; i < GetNumberOfPoints(); i++) {
-        smoothedSignal->AddPoint(GetRawData(i) - averagedSignal[i]);
+        if (IsFloat()) {
+            smoothedSignal->AddFloatPoint(GetRawData(i) - averagedSignal[i]);
+        } else {
+            smoothedSignal->AddPoint(GetRawData(i) - averagedSignal[i]);
+        }
     }
 }
 
+///////////////////////////////////////////////
+/// \brief It constrains a baseline range to the existing data points, so that a range exceeding
+/// the samples of a cropped signal is reduced to the samples available.
+///
+void TRestRawSignal::ConstrainBaseLineRange(Int_t& startBin, Int_t& endBin) const {
+    startBin = std::max(startBin, 0);
+    endBin = std::min(endBin, GetNumberOfPoints());
+}
+
 ///////////////////////////////////////////////
 /// \brief This method is called by CalculateBaseLine and is used to determine the value of the baseline as
 /// average (arithmetic mean) of the data points found
 /// in the range defined between startBin and endBin.
 ///
 void TRestRawSignal::CalculateBaseLineMean(Int_t startBin, Int_t endBin) {
+    ConstrainBaseLineRange(startBin, endBin);
     if (endBin - startBin <= 0) {
         fBaseLine = 0.;
-    } else if (endBin > (int)fSignalData.size()) {
-        cout << "TRestRawSignal::CalculateBaseLine. Error! Baseline range exceeds the rawdata depth!!"
-             << endl;
-        endBin = fSignalData.size();
     } else {
-        Double_t baseLine = 0;
-        for (int i = startBin; i < endBin; i++) baseLine += fSignalData[i];
+        Double_t baseLine = WithSamples(fSignalData, fFloatData, startBin, endBin - startBin,
+                                        [](const auto* data, auto n) { return SumKernel(data, n); });
         fBaseLine = baseLine / (endBin - startBin);
     }
 }
@@ -745,12 +1607,12 @@ void TRestRawSignal::CalculateBaseLineMean(Int_t startBin, Int_t endBin) {
 /// endBin.
 ///
 void TRestRawSignal::CalculateBaseLineMedian(Int_t startBin, Int_t endBin) {
+    ConstrainBaseLineRange(startBin, endBin);
     if (endBin - startBin <= 0) {
         fBaseLine = 0.;
-    } else if (endBin > (int)fSignalData.size()) {
-        cout << "TRestRawSignal::CalculateBaseLine. Error! Baseline range exceeds the rawdata depth!!"
-             << endl;
-        endBin = fSignalData.size();
+    } else if (IsFloat()) {
+        vector<Float_t> v(fFloatData.begin() + startBin, fFloatData.begin() + endBin);
+        fBaseLine = TMath::Median(endBin - startBin, v.data());
     } else {
         vector<Short_t>::const_iterator first = fSignalData.begin() + startBin;
         vector<Short_t>::const_iterator last = fSignalData.begin() + endBin;
@@ -766,6 +1628,9 @@ void TRestRawSignal::CalculateBaseLineMedian(Int_t startBin, Int_t endBin) {
 /// Without further option, this method calculates the average as arithmetic mean,
 /// and the fluctuation as standard deviation.
 ///
+/// The range [startBin, endBin) is given in bins of the stored data points, and it is constrained
+/// to the existing data points.
+///
 /// \param option By setting this option to "ROBUST", the average is calculated as median,
 /// and the fluctuation as interquartile range (IQR), which are less affected by outliers (e.g. a signal
 /// pulse).
@@ -786,12 +1651,15 @@ void TRestRawSignal::CalculateBaseLine(Int_t startBin, Int_t endBin, const std::
 /// fluctuation as its standard deviation in the baseline range provided.
 ///
 void TRestRawSignal::CalculateBaseLineSigmaSD(Int_t startBin, Int_t endBin) {
+    ConstrainBaseLineRange(startBin, endBin);
     if (endBin - startBin <= 0) {
         fBaseLineSigma = 0;
     } else {
-        Double_t baseLineSigma = 0;
-        for (int i = startBin; i < endBin; i++)
-            baseLineSigma += (fBaseLine - fSignalData[i]) * (fBaseLine - fSignalData[i]);
+        const Double_t baseLine = fBaseLine;
+        Double_t baseLineSigma =
+            WithSamples(fSignalData, fFloatData, startBin, endBin - startBin, [&](const auto* data, auto n) {
+                return SquaredDeviationKernel(data, n, baseLine);
+            });
         fBaseLineSigma = TMath::Sqrt(baseLineSigma / (endBin - startBin));
     }
 }
@@ -803,8 +1671,14 @@ void TRestRawSignal::CalculateBaseLineSigmaSD(Int_t startBin, Int_t endBin) {
 /// towards outliers than the standard deviation.
 ///
 void TRestRawSignal::CalculateBaseLineSigmaIQR(Int_t startBin, Int_t endBin) {
+    ConstrainBaseLineRange(startBin, endBin);
     if (endBin - startBin <= 0) {
         fBaseLineSigma = 0;
+    } else if (IsFloat()) {
+        vector<Float_t> v(fFloatData.begin() + startBin, fFloatData.begin() + endBin);
+        std::sort(v.begin(), v.end());
+        Double_t IQR = v[(int)(endBin - startBin) * 0.75] - v[(int)(endBin - startBin) * 0.25];
+        fBaseLineSigma = IQR / 1.349;
     } else {
         vector<Short_t>::const_iterator first = fSignalData.begin() + startBin;
         vector<Short_t>::const_iterator last = fSignalData.begin() + endBin;
@@ -822,20 +1696,115 @@ void TRestRawSignal::CalculateBaseLineSigmaIQR(Int_t startBin, Int_t endBin) {
 /// \brief This method adds an offset to the signal data
 ///
 void TRestRawSignal::AddOffset(Short_t offset) {
-    if (fBaseLine != 0 || fBaseLineSigma != 0) fBaseLineSigma += (Double_t)offset;
-    for (int i = 0; i < GetNumberOfPoints(); i++) fSignalData[i] = fSignalData[i] + offset;
+    if (fBaseLine != 0 || fBaseLineSigma != 0) fBaseLine += (Double_t)offset;
+    for (auto& value : fSignalData) value = value + offset;
+    for (auto& value : fFloatData) value += offset;
+}
+
+///////////////////////////////////////////////
+/// \brief It applies a linear calibration to the signal data, replacing each
+/// point by gain * value + offset.
+///
+/// The results are rounded to the nearest integer and saturated to the Short_t
+/// range, and the data are modified in place in a single pass. For floating
+/// point signals the calibrated values are kept without rounding. If the baseline
+/// was already calculated, the baseline and its fluctuation are transformed
+/// accordingly.
+///
+void TRestRawSignal::Calibrate(Double_t gain, Double_t offset) {
+    if (fBaseLine != 0 || fBaseLineSigma != 0) {
+        fBaseLine = gain * fBaseLine + offset;
+        fBaseLineSigma = std::abs(gain) * fBaseLineSigma;
+    }
+
+    if (IsFloat()) {
+        for (auto& value : fFloatData) value = std::fma((Float_t)gain, value, (Float_t)offset);
+        return;
+    }
+
+    const Float_t g = gain;
+    const Float_t o = offset + 0.5;
+    Short_t* data = fSignalData.data();
+    const Int_t nPoints = GetNumberOfPoints();
+    for (int i = 0; i < nPoints; i++) {
+        const Float_t value = std::floor(std::fma(g, (Float_t)data[i], o));
+        data[i] = (Short_t)std::min(std::max(value, -32768.f), 32767.f);
+    }
 }
 
 ///////////////////////////////////////////////
 /// \brief This method scales the signal by a given value
 ///
 void TRestRawSignal::Scale(Double_t value) {
+    if (IsFloat()) {
+        for (auto& data : fFloatData) data *= value;
+        return;
+    }
+
     for (int i = 0; i < GetNumberOfPoints(); i++) {
         Double_t scaledValue = value * fSignalData[i];
         fSignalData[i] = (Short_t)scaledValue;
     }
 }
 
+///////////////////////////////////////////////
+/// \brief This method removes single point spikes, or glitches, from the signal data.
+///
+/// Each point is compared to the median of the window centered at the point, and it is replaced
+/// by the median when they differ by more than the given threshold. Contrary to the moving average
+/// smoothing, the points which are not spikes are left unchanged, and the leading and trailing edges
+/// of the pulses are preserved. The medians are obtained with min/max networks, without branches,
+/// and the data are modified in place. The first and last points are repeated at the edges.
+///
+/// \param threshold The minimum deviation, in ADC units, from the median to consider the point a spike
+///
+/// \param window The number of points used for the median, 3 or 5
+///
+/// \return The number of points that have been replaced
+///
+Int_t TRestRawSignal::RemoveSpikes(Double_t threshold, Int_t window) {
+    const Int_t nPoints = GetNumberOfPoints();
+    if (nPoints == 0) return 0;
+
+    if (IsFloat()) return RemoveSpikesKernel(fFloatData.data(), nPoints, threshold, window);
+
+    return RemoveSpikesKernel(fSignalData.data(), nPoints, threshold, window);
+}
+
+///////////////////////////////////////////////
+/// \brief It reduces the signal to the points inside the range [from, to).
+///
+/// The range is constrained to the existing data points. The bin of the first remaining point
+/// in the original acquisition window is kept at fStartBin, so that GetStartBin() + bin
+/// recovers the original time bin of any point of the cropped signal. The baseline is kept,
+/// while the points over threshold and the calculation range are reset, since they are
+/// defined in terms of the previous bins.
+///
+void TRestRawSignal::Crop(Int_t from, Int_t to) {
+    from = std::max(from, 0);
+    to = std::min(to, GetNumberOfPoints());
+    if (to <= from) {
+        fStartBin += GetNumberOfPoints();
+        fSignalData.clear();
+        fFloatData.clear();
+    } else {
+        fStartBin += from;
+        auto crop = [&](auto& data) {
+            data.erase(data.begin() + to, data.end());
+            data.erase(data.begin(), data.begin() + from);
+        };
+        if (IsFloat()) {
+            crop(fFloatData);
+        } else {
+            crop(fSignalData);
+        }
+    }
+
+    fPointsOverThreshold.clear();
+    fThresholdIntegral = -1;
+    fRange = TVector2(0, 0);
+}
+
 ///////////////////////////////////////////////
 /// \brief This method adds the signal provided by argument to the existing
 /// signal.
@@ -847,6 +1816,11 @@ void TRestRawSignal::SignalAddition(const TRestRawSignal& signal) {
         return;
     }
 
+    if (IsFloat()) {
+        for (int i = 0; i < GetNumberOfPoints(); i++) fFloatData[i] += signal.GetData(i);
+        return;
+    }
+
     for (int i = 0; i < GetNumberOfPoints(); i++) {
         fSignalData[i] += signal.GetData(i);
     }
@@ -888,10 +1862,10 @@ TGraph* TRestRawSignal::GetGraph(Int_t color) {
     fGraph->SetMarkerStyle(7);
 
     for (int i = 0; i < GetNumberOfPoints(); i++) {
-        fGraph->SetPoint(i, i, GetData(i));
+        fGraph->SetPoint(i, fStartBin + i, GetData(i));
     }
 
-    fGraph->GetXaxis()->SetLimits(0, GetNumberOfPoints() - 1);
+    fGraph->GetXaxis()->SetLimits(fStartBin, fStartBin + GetNumberOfPoints() - 1);
 
     /*
      * To draw x axis in multiples of 2
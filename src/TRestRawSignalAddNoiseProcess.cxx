@@ -118,6 +118,7 @@ TRestEvent* TRestRawSignalAddNoiseProcess::ProcessEvent(TRestEvent* inputEvent)
         // Assign ID and add noise
         fInputSignalEvent->GetSignal(n)->GetWhiteNoiseSignal(&noiseSignal, fNoiseLevel);
         noiseSignal.SetSignalID(fInputSignalEvent->GetSignal(n)->GetSignalID());
+        noiseSignal.SetStartBin(fInputSignalEvent->GetSignal(n)->GetStartBin());
 
         fOutputSignalEvent->AddSignal(noiseSignal);
     }
@@ -43,6 +43,17 @@
 /// * **pointsOverThreshold**: The minimum number of points over threshold to
 /// identify a signal as such
 ///
+/// The constant fraction time of each signal is obtained if the parameter
+/// **cfdFraction** is given, using **cfdDelay** bins as delay. If the delay is
+/// not given, or it is not positive, the time at which the leading edge crosses
+/// that fraction of the amplitude is used instead. See
+/// TRestRawSignal::GetConstantFractionTime.
+///
+/// Multiple pulses in a signal, e.g. due to pile-up, are identified if the
+/// parameter **pulseHysteresis** is given. It defines, in baseline sigmas, the
+/// minimum drop and rise of the signal between two consecutive pulses inside
+/// the points over threshold. See TRestRawSignal::FindPulses.
+///
 /// Additionaly, there is a metadata parameter,*signalsRange* that allows to
 /// define the signal ids over which this process will have effect. This
 /// parameter may allow to define different TRestRawSignalAnalysisProcess
@@ -199,6 +210,27 @@
 /// A certain number of samples must pass the threshold to be taken into
 /// account.
 ///
+/// Sub-bin timing observables:
+///
+/// * **peak_time_fine_map**: Map the ID of each signal in the event with the
+/// position of its maximum, interpolated with a parabola through the maximum
+/// bin and its neighbours.
+/// * **cfd_time_map**: Map the ID of each signal in the event with its
+/// constant fraction time. Only if *cfdFraction* is defined.
+///
+/// Multiple pulses observables, only if *pulseHysteresis* is defined:
+///
+/// * **npulses_map**: Map the ID of each signal in the event with the number
+/// of pulses found.
+/// * **NumberOfPulses**: The number of pulses found in the event.
+/// * **pulse_signal_ids**: The signal ID of each of the pulses found.
+/// * **pulse_times**: The peak bin of each of the pulses found.
+/// * **pulse_amplitudes**: The amplitude of each of the pulses found.
+/// * **pulse_integrals**: The integral of each of the pulses found.
+///
+/// All the time observables are given in bins of the original acquisition
+/// window, so that they are not modified when the signals have been cropped
+/// by TRestRawSignalROICropProcess.
 ///
 /// You may add filters to any observable inside the analysis tree. To add a cut,
 /// write "cut" sections in your rml file:
@@ -290,6 +322,13 @@ TRestEvent* TRestRawSignalAnalysisProcess::ProcessEvent(TRestEvent* inputEvent)
     map<int, int> peak_time;
     map<int, int> npointsot;
     vector<int> saturatedchnId;
+    map<int, Double_t> peak_time_fine;
+    map<int, Double_t> cfd_time;
+    map<int, int> npulses;
+    vector<int> pulseIds;
+    vector<double> pulseTimes;
+    vector<double> pulseAmplitudes;
+    vector<double> pulseIntegrals;
 
     baseline.clear();
     baselinesigma.clear();
@@ -337,9 +376,24 @@ TRestEvent* TRestRawSignalAnalysisProcess::ProcessEvent(TRestEvent* inputEvent)
         ampsgn_intmethod[sgnl->GetID()] = sgnl->GetThresholdIntegral();
         ampsgn_maxmethod[sgnl->GetID()] = sgnl->GetMaxPeakValue();
         risetime[sgnl->GetID()] = sgnl->GetRiseTime();
-        peak_time[sgnl->GetID()] = sgnl->GetMaxPeakBin();
+        peak_time[sgnl->GetID()] = sgnl->GetStartBin() + sgnl->GetMaxPeakBin();
         npointsot[sgnl->GetID()] = sgnl->GetPointsOverThreshold().size();
+        peak_time_fine[sgnl->GetID()] = sgnl->GetStartBin() + sgnl->GetMaxPeakTime();
+        if (fCFDFraction > 0) {
+            Double_t cfdTime = sgnl->GetConstantFractionTime(fCFDFraction, fCFDDelay);
+            cfd_time[sgnl->GetID()] = cfdTime < 0 ? cfdTime : sgnl->GetStartBin() + cfdTime;
+        }
         if (sgnl->IsADCSaturation()) saturatedchnId.push_back(sgnl->GetID());
+
+        if (fPulseHysteresis > 0) {
+            npulses[sgnl->GetID()] = sgnl->FindPulses(fPulses, fPulseHysteresis * sgnl->GetBaseLineSigma());
+            for (const auto& pulse : fPulses) {
+                pulseIds.push_back(sgnl->GetID());
+                pulseTimes.push_back(sgnl->GetStartBin() + pulse.peakBin);
+                pulseAmplitudes.push_back(pulse.amplitude);
+                pulseIntegrals.push_back(pulse.integral);
+            }
+        }
     }
 
     SetObservableValue("pointsoverthres_map", npointsot);
@@ -350,6 +404,17 @@ TRestEvent* TRestRawSignalAnalysisProcess::ProcessEvent(TRestEvent* inputEvent)
     SetObservableValue("max_amplitude_map", ampsgn_maxmethod);
     SetObservableValue("thr_integral_map", ampsgn_intmethod);
     SetObservableValue("SaturatedChannelID", saturatedchnId);
+    SetObservableValue("peak_time_fine_map", peak_time_fine);
+    if (fCFDFraction > 0) SetObservableValue("cfd_time_map", cfd_time);
+
+    if (fPulseHysteresis > 0) {
+        SetObservableValue("npulses_map", npulses);
+        SetObservableValue("NumberOfPulses", (Int_t)pulseIds.size());
+        SetObservableValue("pulse_signal_ids", pulseIds);
+        SetObservableValue("pulse_times", pulseTimes);
+        SetObservableValue("pulse_amplitudes", pulseAmplitudes);
+        SetObservableValue("pulse_integrals", pulseIntegrals);
+    }
 
     Double_t baseLineMean = fSignalEvent->GetBaseLineAverage();
     SetObservableValue("BaseLineMean", baseLineMean);
@@ -444,7 +509,7 @@ TRestEvent* TRestRawSignalAnalysisProcess::ProcessEvent(TRestEvent* inputEvent)
             if (value > maxValue) maxValue = value;
             if (value < minValue) minValue = value;
 
-            Double_t peakBin = sgnl->GetMaxPeakBin();
+            Double_t peakBin = sgnl->GetStartBin() + sgnl->GetMaxPeakBin();
             peakTimeAverage += peakBin;
 
             if (minPeakTime > peakBin) minPeakTime = peakBin;
@@ -0,0 +1,231 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawSignalCalibrationProcess equalizes the response of the
+/// channels of a TRestRawSignalEvent, applying a gain and an offset to each
+/// signal, so that each point is replaced by gain * value + offset. See
+/// TRestRawSignal::Calibrate for details.
+///
+/// The gain and offset of each channel are read at InitProcess from the tab
+/// separated table at `calibrationFile`, where each row contains the DAQ id,
+/// the gain and the offset of one channel. They are stored in arrays indexed
+/// by DAQ id, so that no search is required while processing the events. The
+/// channels not found at the table are not modified.
+///
+/// The signals are modified in place, and the input event is returned. The
+/// process is cheap, so that it can be placed at the beginning of any
+/// processing chain.
+///
+/// The process can also change the sample type of the signals. When
+/// `sampleType` is `float`, the signals are converted to floating point
+/// samples (see TRestRawSignal::ConvertToFloat) before the calibration, so
+/// that the calibrated values, and the results of the following processes
+/// supporting floating point samples (shaping, recursive filter, wavelet
+/// denoising, cross-talk correction, channel recovery, baseline correction),
+/// are not rounded at each step. When it is `short`, the floating point
+/// values are removed after the calibration, and only the rounded values are
+/// kept. The calibration file is optional when the process is used only to
+/// change the sample type.
+///
+/// The different parameters allowed in this process are:
+///
+/// * **calibrationFile**: the file containing the gain and offset of each
+/// channel.
+/// * **sampleType**: `float` or `short`, the sample type of the output
+/// signals. If not given, the sample type is not modified.
+/// * **signalsRange**: only the signals with ids inside this range are
+/// calibrated.
+///
+/// \code
+///   <addProcess type="TRestRawSignalCalibrationProcess" name="calibration" value="ON" >
+///       <parameter name="calibrationFile" value="channelGains.txt" />
+///       <parameter name="sampleType" value="float" />
+///   </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawSignalCalibrationProcess
+///
+/// <hr>
+///
+#include "TRestRawSignalCalibrationProcess.h"
+
+#include "TRestTools.h"
+
+using namespace std;
+
+ClassImp(TRestRawSignalCalibrationProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawSignalCalibrationProcess::TRestRawSignalCalibrationProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawSignalCalibrationProcess::TRestRawSignalCalibrationProcess(const char* configFilename) {
+    Initialize();
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawSignalCalibrationProcess::~TRestRawSignalCalibrationProcess() {}
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawSignalCalibrationProcess::Initialize() {
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fSignalEvent = nullptr;
+}
+
+///////////////////////////////////////////////
+/// \brief Process initialization. The calibration table is loaded here.
+///
+void TRestRawSignalCalibrationProcess::InitProcess() {
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1) fRangeEnabled = true;
+
+    if (fSampleType != "" && fSampleType != "float" && fSampleType != "short") {
+        RESTWarning << "TRestRawSignalCalibrationProcess. Unknown sample type : " << fSampleType
+                    << ". The sample type will not be modified" << RESTendl;
+        fSampleType = "";
+    }
+
+    if (fCalibrationFile == "") {
+        if (fSampleType == "")
+            RESTWarning << "TRestRawSignalCalibrationProcess. No calibration file given" << RESTendl;
+        return;
+    }
+
+    if (!LoadCalibration()) exit(1);
+}
+
+///////////////////////////////////////////////
+/// \brief It reads the gain and offset of each channel from the calibration
+/// file. It returns false if the file is not found or a row is not valid.
+///
+Bool_t TRestRawSignalCalibrationProcess::LoadCalibration() {
+    string fullPath = SearchFile((string)fCalibrationFile);
+    vector<vector<Double_t>> table;
+    if (fullPath.empty() || !TRestTools::ReadASCIITable(fullPath, table)) {
+        RESTError << "TRestRawSignalCalibrationProcess. Calibration file not found : " << fCalibrationFile
+                  << RESTendl;
+        return false;
+    }
+
+    fGains.clear();
+    fOffsets.clear();
+    for (size_t n = 0; n < table.size(); n++) {
+        const vector<Double_t>& row = table[n];
+        if (row.size() != 3 || row[0] < 0) {
+            RESTError << "TRestRawSignalCalibrationProcess. Wrong calibration definition at row " << n
+                      << RESTendl;
+            return false;
+        }
+
+        const Int_t id = (Int_t)row[0];
+        if (id >= (Int_t)fGains.size()) {
+            fGains.resize(id + 1, 1);
+            fOffsets.resize(id + 1, 0);
+        }
+        fGains[id] = row[1];
+        fOffsets[id] = row[2];
+    }
+
+    RESTDebug << "TRestRawSignalCalibrationProcess. " << table.size() << " channels loaded" << RESTendl;
+
+    return true;
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function
+///
+TRestEvent* TRestRawSignalCalibrationProcess::ProcessEvent(TRestEvent* inputEvent) {
+    fSignalEvent = (TRestRawSignalEvent*)inputEvent;
+
+    for (int s = 0; s < fSignalEvent->GetNumberOfSignals(); s++) {
+        TRestRawSignal* sgnl = fSignalEvent->GetSignal(s);
+
+        if (fSampleType == "float") sgnl->ConvertToFloat();
+
+        const Int_t id = sgnl->GetID();
+        Bool_t calibrate = id >= 0 && id < (Int_t)fGains.size() && (fGains[id] != 1 || fOffsets[id] != 0);
+        if (fRangeEnabled && (id < fSignalsRange.X() || id > fSignalsRange.Y())) calibrate = false;
+
+        if (calibrate) sgnl->Calibrate(fGains[id], fOffsets[id]);
+
+        if (fSampleType == "short") sgnl->ConvertToShort();
+    }
+
+    return fSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints out the process parameters stored in the metadata structure
+///
+void TRestRawSignalCalibrationProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Calibration file : " << fCalibrationFile << RESTendl;
+    if (fSampleType != "") RESTMetadata << "Sample type : " << fSampleType << RESTendl;
+    if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Info) {
+        for (size_t id = 0; id < fGains.size(); id++)
+            if (fGains[id] != 1 || fOffsets[id] != 0)
+                RESTMetadata << "Channel " << id << " : gain " << fGains[id] << ", offset " << fOffsets[id]
+                             << RESTendl;
+    }
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1)
+        RESTMetadata << "Signals range : (" << fSignalsRange.X() << ", " << fSignalsRange.Y() << ")"
+                     << RESTendl;
+
+    EndPrintProcess();
+}
@@ -0,0 +1,340 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawSignalClusteringProcess groups the active channels of a
+/// TRestRawSignalEvent into clusters of neighbour channels with coincident
+/// pulses. It provides a cheap description of the event topology at the raw
+/// signal level, before the signals are transformed into detector hits.
+///
+/// A channel is active if it has points over threshold, defined as in
+/// TRestRawSignalAnalysisProcess. Two active channels belong to the same
+/// cluster if they are neighbours and the time ranges covered by their points
+/// over threshold overlap, or they are separated by at most `timeTolerance`
+/// bins. The clusters are the connected groups of channels built with these
+/// links, and they are found with a union-find structure.
+///
+/// The neighbours of each channel are defined by the `neighbours` parameter:
+///
+/// * **readout**: the channels next to each other inside the same readout
+/// module of the TRestDetectorReadout found in the processing chain. The
+/// neighbour map is built once, at InitProcess. If the detector library or
+/// the readout are not available, the daq definition is used instead.
+/// * **daq**: the channels with consecutive DAQ ids.
+///
+/// The different parameters allowed in this process are:
+///
+/// * **neighbours**: the neighbour definition, readout or daq. Default is
+/// readout.
+/// * **timeTolerance**: the maximum separation, in bins, between the points over
+/// threshold of two neighbour channels. Default is 0, they must overlap.
+/// * **baseLineRange**: the range used to calculate the baseline. Default is
+/// (10,90).
+/// * **pointThreshold**, **signalThreshold** and **pointsOverThreshold**: the
+/// points over threshold definition, in baseline sigmas, as in
+/// TRestRawSignalAnalysisProcess. Defaults are 3, 5 and 5.
+/// * **signalsRange**: only the signals with ids inside this range are
+/// processed.
+///
+/// The following observables are available:
+///
+/// * **NumberOfClusters**: the number of clusters found in the event.
+/// * **MaxClusterSize**: the number of channels of the largest cluster.
+/// * **MaxClusterCharge**: the charge of the cluster with the highest charge.
+/// * **cluster_sizes**: the number of channels of each cluster.
+/// * **cluster_charges**: the charge of each cluster, as the sum of the
+/// threshold integrals of its channels.
+///
+/// \code
+///   <addProcess type="TRestRawSignalClusteringProcess" name="clusters" value="ON" >
+///       <parameter name="neighbours" value="readout" />
+///       <parameter name="timeTolerance" value="2" />
+///       <parameter name="baseLineRange" value="(20,120)" />
+///       <observable name="NumberOfClusters" value="ON" />
+///       <observable name="MaxClusterCharge" value="ON" />
+///   </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawSignalClusteringProcess
+///
+/// <hr>
+///
+#include "TRestRawSignalClusteringProcess.h"
+
+using namespace std;
+
+ClassImp(TRestRawSignalClusteringProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawSignalClusteringProcess::TRestRawSignalClusteringProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawSignalClusteringProcess::TRestRawSignalClusteringProcess(const char* configFilename) {
+    Initialize();
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawSignalClusteringProcess::~TRestRawSignalClusteringProcess() {}
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawSignalClusteringProcess::Initialize() {
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fSignalEvent = nullptr;
+}
+
+///////////////////////////////////////////////
+/// \brief Process initialization. The neighbour map is built here.
+///
+void TRestRawSignalClusteringProcess::InitProcess() {
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1) fRangeEnabled = true;
+
+    if (fNeighbours != "readout" && fNeighbours != "daq") {
+        RESTWarning << "TRestRawSignalClusteringProcess. Neighbours : " << fNeighbours
+                    << " is not supported. Using daq neighbours." << RESTendl;
+        fNeighbours = "daq";
+    }
+
+    fUseReadout = false;
+#ifdef REST_DetectorLib
+    if (fNeighbours == "readout") {
+        fReadout = GetMetadata<TRestDetectorReadout>();
+        fUseReadout = (fReadout != nullptr);
+    }
+#endif
+    if (fNeighbours == "readout" && !fUseReadout)
+        RESTWarning << "TRestRawSignalClusteringProcess. No readout found. Using daq neighbours." << RESTendl;
+
+    if (fTimeTolerance < 0) fTimeTolerance = 0;
+
+    BuildNeighbourMap();
+}
+
+///////////////////////////////////////////////
+/// \brief It builds the list of neighbours of each DAQ id from the readout
+/// definition. The lists are stored consecutively at fNeighbourIds, and
+/// fNeighbourOffsets gives the position of the first neighbour of each DAQ id,
+/// so that no search is required while processing the events.
+///
+void TRestRawSignalClusteringProcess::BuildNeighbourMap() {
+    fNeighbourOffsets.clear();
+    fNeighbourIds.clear();
+    if (!fUseReadout) return;
+
+#ifdef REST_DetectorLib
+    map<Int_t, vector<Int_t>> neighbours;
+    for (int p = 0; p < fReadout->GetNumberOfReadoutPlanes(); p++) {
+        TRestDetectorReadoutPlane* plane = fReadout->GetReadoutPlane(p);
+        for (int m = 0; m < plane->GetNumberOfModules(); m++) {
+            TRestDetectorReadoutModule* mod = plane->GetModule(m);
+            const int nChannels = mod->GetNumberOfChannels();
+            for (int c = 0; c < nChannels; c++) {
+                const Int_t daqId = mod->GetChannel(c)->GetDaqID();
+                if (daqId < 0) continue;
+                if (c > 0) neighbours[daqId].push_back(mod->GetChannel(c - 1)->GetDaqID());
+                if (c + 1 < nChannels) neighbours[daqId].push_back(mod->GetChannel(c + 1)->GetDaqID());
+            }
+        }
+    }
+
+    const Int_t maxId = neighbours.empty() ? -1 : neighbours.rbegin()->first;
+    fNeighbourOffsets.assign(maxId + 2, 0);
+    for (const auto& entry : neighbours) fNeighbourOffsets[entry.first + 1] = entry.second.size();
+    for (int id = 0; id <= maxId; id++) fNeighbourOffsets[id + 1] += fNeighbourOffsets[id];
+
+    fNeighbourIds.resize(fNeighbourOffsets.back());
+    for (const auto& entry : neighbours)
+        copy(entry.second.begin(), entry.second.end(),
+             fNeighbourIds.begin() + fNeighbourOffsets[entry.first]);
+
+    RESTDebug << "TRestRawSignalClusteringProcess. Neighbour map built for " << neighbours.size()
+              << " channels" << RESTendl;
+#endif
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the root of the cluster containing the active signal at
+/// *index*, halving the path to the root on the way.
+///
+Int_t TRestRawSignalClusteringProcess::FindRoot(Int_t index) {
+    while (fParent[index] != index) {
+        fParent[index] = fParent[fParent[index]];
+        index = fParent[index];
+    }
+    return index;
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function
+///
+TRestEvent* TRestRawSignalClusteringProcess::ProcessEvent(TRestEvent* inputEvent) {
+    fSignalEvent = (TRestRawSignalEvent*)inputEvent;
+
+    vector<Int_t> activeIds;
+    fStartTime.clear();
+    fEndTime.clear();
+    fCharge.clear();
+    for (int s = 0; s < fSignalEvent->GetNumberOfSignals(); s++) {
+        TRestRawSignal* sgnl = fSignalEvent->GetSignal(s);
+
+        if (sgnl->GetID() < 0) continue;
+        if (fRangeEnabled && (sgnl->GetID() < fSignalsRange.X() || sgnl->GetID() > fSignalsRange.Y()))
+            continue;
+
+        sgnl->CalculateBaseLine(fBaseLineRange.X(), fBaseLineRange.Y());
+        sgnl->InitializePointsOverThreshold(TVector2(fPointThreshold, fSignalThreshold),
+                                            fPointsOverThreshold);
+
+        const vector<Int_t>& points = sgnl->GetPointsOverThreshold();
+        if (points.empty()) continue;
+
+        activeIds.push_back(sgnl->GetID());
+        fStartTime.push_back(sgnl->GetStartBin() + points.front());
+        fEndTime.push_back(sgnl->GetStartBin() + points.back());
+        fCharge.push_back(sgnl->GetThresholdIntegral());
+    }
+
+    // The bitmap of active channels, giving the index of the active signal for each DAQ id
+    const Int_t nActive = activeIds.size();
+    for (int k = 0; k < nActive; k++) {
+        if (activeIds[k] >= (Int_t)fActiveIndex.size()) fActiveIndex.resize(activeIds[k] + 1, -1);
+        fActiveIndex[activeIds[k]] = k;
+    }
+
+    fParent.resize(nActive);
+    for (int k = 0; k < nActive; k++) fParent[k] = k;
+
+    auto link = [&](Int_t k, Int_t neighbourId) {
+        if (neighbourId < 0 || neighbourId >= (Int_t)fActiveIndex.size()) return;
+        const Int_t j = fActiveIndex[neighbourId];
+        if (j < 0) return;
+        if (fStartTime[j] > fEndTime[k] + fTimeTolerance || fStartTime[k] > fEndTime[j] + fTimeTolerance)
+            return;
+        const Int_t rootK = FindRoot(k);
+        const Int_t rootJ = FindRoot(j);
+        if (rootK != rootJ) fParent[max(rootK, rootJ)] = min(rootK, rootJ);
+    };
+
+    for (int k = 0; k < nActive; k++) {
+        const Int_t id = activeIds[k];
+        if (fUseReadout) {
+            if (id + 1 >= (Int_t)fNeighbourOffsets.size()) continue;
+            for (int n = fNeighbourOffsets[id]; n < fNeighbourOffsets[id + 1]; n++) link(k, fNeighbourIds[n]);
+        } else {
+            link(k, id - 1);
+            link(k, id + 1);
+        }
+    }
+
+    // The roots are the lowest index of each cluster, so that the clusters are numbered in input order
+    fClusterSizes.clear();
+    fClusterCharges.clear();
+    vector<Int_t> clusterIndex(nActive, -1);
+    for (int k = 0; k < nActive; k++) {
+        const Int_t root = FindRoot(k);
+        if (clusterIndex[root] == -1) {
+            clusterIndex[root] = fClusterSizes.size();
+            fClusterSizes.push_back(0);
+            fClusterCharges.push_back(0);
+        }
+        fClusterSizes[clusterIndex[root]]++;
+        fClusterCharges[clusterIndex[root]] += fCharge[k];
+    }
+
+    for (const auto& id : activeIds) fActiveIndex[id] = -1;
+
+    Int_t maxClusterSize = 0;
+    Double_t maxClusterCharge = 0;
+    for (size_t n = 0; n < fClusterSizes.size(); n++) {
+        maxClusterSize = max(maxClusterSize, fClusterSizes[n]);
+        maxClusterCharge = max(maxClusterCharge, fClusterCharges[n]);
+    }
+
+    SetObservableValue("NumberOfClusters", (Int_t)fClusterSizes.size());
+    SetObservableValue("MaxClusterSize", maxClusterSize);
+    SetObservableValue("MaxClusterCharge", maxClusterCharge);
+    SetObservableValue("cluster_sizes", fClusterSizes);
+    SetObservableValue("cluster_charges", fClusterCharges);
+
+    RESTDebug << "TRestRawSignalClusteringProcess. Event " << fSignalEvent->GetID() << " : "
+              << fClusterSizes.size() << " clusters from " << nActive << " active channels" << RESTendl;
+
+    return fSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints out the process parameters stored in the metadata structure
+///
+void TRestRawSignalClusteringProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Neighbours : " << fNeighbours << RESTendl;
+    RESTMetadata << "Time tolerance : " << fTimeTolerance << " bins" << RESTendl;
+    RESTMetadata << "Baseline range : (" << fBaseLineRange.X() << ", " << fBaseLineRange.Y() << ")"
+                 << RESTendl;
+    RESTMetadata << "Point threshold : " << fPointThreshold << " sigmas" << RESTendl;
+    RESTMetadata << "Signal threshold : " << fSignalThreshold << " sigmas" << RESTendl;
+    RESTMetadata << "Number of points over threshold : " << fPointsOverThreshold << RESTendl;
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1)
+        RESTMetadata << "Signals range : (" << fSignalsRange.X() << ", " << fSignalsRange.Y() << ")"
+                     << RESTendl;
+#ifndef REST_DetectorLib
+    RESTMetadata << "Readout neighbours are not available without the detector library!" << RESTendl;
+#endif
+
+    EndPrintProcess();
+}
@@ -0,0 +1,294 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawSignalCrossTalkCorrectionProcess removes the cross-talk, such
+/// as the capacitive coupling between neighbour strips of a Micromegas
+/// readout, from the signals of a TRestRawSignalEvent.
+///
+/// The cross-talk is described by a coupling matrix C, where the element
+/// C(i,j) is the fraction of the baseline corrected signal of channel j that
+/// is induced at channel i. The corrected signals are obtained at each time
+/// bin as y = (I - C) x, where x are the baseline corrected input signals.
+/// The baseline of each signal is added back afterwards.
+///
+/// The matrix is sparse, since each channel couples only to a few others, and
+/// it is stored by columns, so that each signal found in the event only
+/// visits the channels it couples to. The cost of the correction is then
+/// proportional to the number of signals in the event, and for each coupling
+/// the whole signal is corrected at once over contiguous samples. The
+/// couplings to channels not present in the event are ignored.
+///
+/// The coupling matrix is read at InitProcess from the tab separated table at
+/// `couplingFile`, where each row contains the target DAQ id, i, the source
+/// DAQ id, j, and the coefficient C(i,j). A different file should be used for
+/// each detector.
+///
+/// The different parameters allowed in this process are:
+///
+/// * **couplingFile**: the file containing the coupling matrix.
+/// * **baseLineRange**: the range used to calculate the baseline. Default is
+/// (10,90).
+/// * **signalsRange**: only the signals with ids inside this range are
+/// corrected, and contribute to the correction of other signals.
+///
+/// \code
+///   <addProcess type="TRestRawSignalCrossTalkCorrectionProcess" name="crossTalk" value="ON" >
+///       <parameter name="couplingFile" value="micromegasCoupling.txt" />
+///       <parameter name="baseLineRange" value="(20,120)" />
+///   </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawSignalCrossTalkCorrectionProcess
+///
+/// <hr>
+///
+#include "TRestRawSignalCrossTalkCorrectionProcess.h"
+
+#include "TRestTools.h"
+
+using namespace std;
+
+ClassImp(TRestRawSignalCrossTalkCorrectionProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawSignalCrossTalkCorrectionProcess::TRestRawSignalCrossTalkCorrectionProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawSignalCrossTalkCorrectionProcess::TRestRawSignalCrossTalkCorrectionProcess(
+    const char* configFilename) {
+    Initialize();
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawSignalCrossTalkCorrectionProcess::~TRestRawSignalCrossTalkCorrectionProcess() {
+    delete fOutputSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawSignalCrossTalkCorrectionProcess::Initialize() {
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fInputSignalEvent = nullptr;
+    fOutputSignalEvent = new TRestRawSignalEvent();
+}
+
+///////////////////////////////////////////////
+/// \brief Process initialization. The coupling matrix is loaded here.
+///
+void TRestRawSignalCrossTalkCorrectionProcess::InitProcess() {
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1) fRangeEnabled = true;
+
+    if (!LoadCouplingMatrix()) exit(1);
+}
+
+///////////////////////////////////////////////
+/// \brief It reads the coupling matrix from the coupling file and stores it by
+/// columns. It returns false if the file is not found or a row is not valid.
+///
+Bool_t TRestRawSignalCrossTalkCorrectionProcess::LoadCouplingMatrix() {
+    string fullPath = SearchFile((string)fCouplingFile);
+    vector<vector<Double_t>> table;
+    if (fullPath.empty() || !TRestTools::ReadASCIITable(fullPath, table)) {
+        RESTError << "TRestRawSignalCrossTalkCorrectionProcess. Coupling file not found : " << fCouplingFile
+                  << RESTendl;
+        return false;
+    }
+
+    map<Int_t, vector<pair<Int_t, Float_t>>> columns;
+    for (size_t n = 0; n < table.size(); n++) {
+        const vector<Double_t>& row = table[n];
+        if (row.size() != 3 || row[0] < 0 || row[1] < 0) {
+            RESTError << "TRestRawSignalCrossTalkCorrectionProcess. Wrong coupling definition at row " << n
+                      << RESTendl;
+            return false;
+        }
+        // The diagonal is the identity, any self-coupling is just a gain
+        if (row[0] == row[1] || row[2] == 0) continue;
+        columns[(Int_t)row[1]].emplace_back((Int_t)row[0], row[2]);
+    }
+
+    const Int_t maxId = columns.empty() ? -1 : columns.rbegin()->first;
+    fColumnOffsets.assign(maxId + 2, 0);
+    for (const auto& column : columns) fColumnOffsets[column.first + 1] = column.second.size();
+    for (int id = 0; id <= maxId; id++) fColumnOffsets[id + 1] += fColumnOffsets[id];
+
+    fTargetIds.clear();
+    fCoefficients.clear();
+    for (const auto& column : columns) {
+        for (const auto& coupling : column.second) {
+            fTargetIds.push_back(coupling.first);
+            fCoefficients.push_back(coupling.second);
+        }
+    }
+
+    RESTDebug << "TRestRawSignalCrossTalkCorrectionProcess. " << fCoefficients.size() << " couplings from "
+              << columns.size() << " channels loaded" << RESTendl;
+
+    return true;
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function
+///
+TRestEvent* TRestRawSignalCrossTalkCorrectionProcess::ProcessEvent(TRestEvent* inputEvent) {
+    fInputSignalEvent = (TRestRawSignalEvent*)inputEvent;
+
+    vector<TRestRawSignal*> signals;
+    for (int s = 0; s < fInputSignalEvent->GetNumberOfSignals(); s++) {
+        TRestRawSignal* sgnl = fInputSignalEvent->GetSignal(s);
+
+        if (sgnl->GetID() < 0 ||
+            (fRangeEnabled && (sgnl->GetID() < fSignalsRange.X() || sgnl->GetID() > fSignalsRange.Y())))
+            continue;
+
+        signals.push_back(sgnl);
+    }
+
+    const Int_t nSignals = signals.size();
+
+    fOffsets.resize(nSignals + 1);
+    fOffsets[0] = 0;
+    for (int c = 0; c < nSignals; c++) fOffsets[c + 1] = fOffsets[c] + signals[c]->GetNumberOfPoints();
+
+    fSamples.resize(fOffsets[nSignals]);
+    fCrossTalk.assign(fOffsets[nSignals], 0);
+    for (int c = 0; c < nSignals; c++) {
+        TRestRawSignal* sgnl = signals[c];
+        sgnl->CalculateBaseLine(fBaseLineRange.X(), fBaseLineRange.Y());
+
+        const Float_t baseLine = sgnl->GetBaseLine();
+        Float_t* x = &fSamples[fOffsets[c]];
+        for (int n = 0; n < sgnl->GetNumberOfPoints(); n++) x[n] = sgnl->GetRawData(n) - baseLine;
+
+        if (sgnl->GetID() >= (Int_t)fSignalIndex.size()) fSignalIndex.resize(sgnl->GetID() + 1, -1);
+        fSignalIndex[sgnl->GetID()] = c;
+    }
+
+    // Column oriented product, each source signal is added to the signals it couples to
+    for (int j = 0; j < nSignals; j++) {
+        const Int_t id = signals[j]->GetID();
+        if (id + 1 >= (Int_t)fColumnOffsets.size()) continue;
+
+        const Float_t* x = &fSamples[fOffsets[j]];
+        for (int k = fColumnOffsets[id]; k < fColumnOffsets[id + 1]; k++) {
+            const Int_t targetId = fTargetIds[k];
+            if (targetId >= (Int_t)fSignalIndex.size() || fSignalIndex[targetId] < 0) continue;
+
+            const Int_t i = fSignalIndex[targetId];
+            const Float_t coefficient = fCoefficients[k];
+
+            // The samples are matched by their bin in the acquisition window, since the signals might
+            // have been cropped. Only the bins present in both signals are coupled.
+            const Int_t shift = signals[i]->GetStartBin() - signals[j]->GetStartBin();
+            const Int_t from = max(0, -shift);
+            const Int_t to = min(signals[i]->GetNumberOfPoints(), signals[j]->GetNumberOfPoints() - shift);
+            Float_t* crossTalk = &fCrossTalk[fOffsets[i]];
+            for (int n = from; n < to; n++) crossTalk[n] += coefficient * x[n + shift];
+        }
+    }
+
+    // The output keeps the order of the input signals, the signals not corrected are copied
+    Int_t c = 0;
+    for (int s = 0; s < fInputSignalEvent->GetNumberOfSignals(); s++) {
+        if (c == nSignals || fInputSignalEvent->GetSignal(s) != signals[c]) {
+            fOutputSignalEvent->AddSignal(*fInputSignalEvent->GetSignal(s));
+            continue;
+        }
+
+        fSignalIndex[signals[c]->GetID()] = -1;
+
+        TRestRawSignal corrected;
+        corrected.SetSignalID(signals[c]->GetSignalID());
+        corrected.SetStartBin(signals[c]->GetStartBin());
+        const Float_t* crossTalk = &fCrossTalk[fOffsets[c]];
+        for (int n = 0; n < signals[c]->GetNumberOfPoints(); n++) {
+            const Double_t value = signals[c]->GetRawData(n) - crossTalk[n];
+            if (signals[c]->IsFloat()) {
+                corrected.AddFloatPoint(value);
+            } else {
+                corrected.AddRoundedPoint(value);
+            }
+        }
+        fOutputSignalEvent->AddSignal(corrected);
+        c++;
+    }
+
+    if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Extreme) {
+        fOutputSignalEvent->PrintEvent();
+        GetChar();
+    }
+
+    return fOutputSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints out the process parameters stored in the metadata structure
+///
+void TRestRawSignalCrossTalkCorrectionProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Coupling file : " << fCouplingFile << RESTendl;
+    RESTMetadata << "Number of couplings : " << fCoefficients.size() << RESTendl;
+    RESTMetadata << "Baseline range : (" << fBaseLineRange.X() << ", " << fBaseLineRange.Y() << ")"
+                 << RESTendl;
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1)
+        RESTMetadata << "Signals range : (" << fSignalsRange.X() << ", " << fSignalsRange.Y() << ")"
+                     << RESTendl;
+
+    EndPrintProcess();
+}
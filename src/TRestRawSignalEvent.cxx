@@ -325,7 +325,7 @@ void TRestRawSignalEvent::SetMaxAndMin() {
         if (fMaxValue < fSignal[s].GetMaxValue()) fMaxValue = fSignal[s].GetMaxValue();
     }
 
-    if (GetNumberOfSignals() > 0) fMaxTime = fSignal[0].GetNumberOfPoints();
+    if (GetNumberOfSignals() > 0) fMaxTime = GetMaxTime();
 }
 
 Double_t TRestRawSignalEvent::GetMaxValue() {
@@ -343,7 +343,12 @@ Double_t TRestRawSignalEvent::GetMinTime() { return 0; }
 Double_t TRestRawSignalEvent::GetMaxTime() {
     Double_t maxTime = 512;
 
-    if (GetNumberOfSignals() > 0) maxTime = fSignal[0].GetNumberOfPoints();
+    if (GetNumberOfSignals() > 0) {
+        maxTime = 0;
+        // Cropped signals may end at different time bins
+        for (const auto& signal : fSignal)
+            maxTime = std::max(maxTime, (Double_t)(signal.GetStartBin() + signal.GetNumberOfPoints()));
+    }
 
     return maxTime;
 }
@@ -610,12 +615,16 @@ void TRestRawSignalEvent::DrawSignals(TPad* pad, const std::vector<Int_t>& signa
     int maxSID = -1;
     int max = numeric_limits<Short_t>::min();
     int graphIndex = 1;
+    int minBin = numeric_limits<int>::max();
+    int maxBin = numeric_limits<int>::min();
 
     for (const auto& s : signals) {
         TRestRawSignal* signal = GetSignalById(s);
         if (!signal) {
             continue;
         }
+        minBin = std::min(minBin, signal->GetStartBin());
+        maxBin = std::max(maxBin, signal->GetStartBin() + signal->GetNumberOfPoints() - 1);
         TGraph* graph = signal->GetGraph(graphIndex++);
         const double maxValue = TMath::MaxElement(graph->GetN(), graph->GetY());
         if (maxValue > max) {
@@ -638,6 +647,8 @@ void TRestRawSignalEvent::DrawSignals(TPad* pad, const std::vector<Int_t>& signa
     }
 
     signalMaxID->fGraph->SetTitle(title.c_str());
+    // Cropped signals may cover different time bins
+    signalMaxID->fGraph->GetXaxis()->SetLimits(minBin, maxBin);
     signalMaxID->fGraph->GetXaxis()->SetTitle("Time bin");
     signalMaxID->fGraph->GetYaxis()->SetTitleOffset(1.4);
     signalMaxID->fGraph->GetYaxis()->SetTitle("Amplitude [a.u.]");
@@ -743,7 +754,8 @@ TPad* TRestRawSignalEvent::DrawSignal(Int_t signalID, TString option) {
     RESTInfo << "Drawing signalID. Event ID : " << this->GetID() << " Signal ID : " << signal->GetID()
              << RESTendl;
 
-    for (int n = 0; n < signal->GetNumberOfPoints(); n++) gr->SetPoint(n, n, signal->GetData(n));
+    for (int n = 0; n < signal->GetNumberOfPoints(); n++)
+        gr->SetPoint(n, signal->GetStartBin() + n, signal->GetData(n));
 
     gr->Draw("AC*");
 
@@ -752,8 +764,11 @@ TPad* TRestRawSignalEvent::DrawSignal(Int_t signalID, TString option) {
     gr2->SetLineWidth(2);
     gr2->SetLineColor(2);  // Red
 
-    for (int n = baseLineRangeInit; n < baseLineRangeEnd; n++)
-        gr2->SetPoint(n - baseLineRangeInit, n, signal->GetData(n));
+    // The baseline range is given in bins of the original acquisition window
+    Int_t baseLineFrom = std::max(baseLineRangeInit, 0);
+    Int_t baseLineTo = std::min(baseLineRangeEnd, signal->GetNumberOfPoints());
+    for (int n = baseLineFrom; n < baseLineTo; n++)
+        gr2->SetPoint(n - baseLineFrom, signal->GetStartBin() + n, signal->GetData(n));
 
     gr2->Draw("CP");
 
@@ -767,7 +782,7 @@ TPad* TRestRawSignalEvent::DrawSignal(Int_t signalID, TString option) {
     Int_t point = 0;
     Int_t nPoints = pOver.size();
     for (int n = 0; n < nPoints; n++) {
-        gr3[nGraphs]->SetPoint(point, pOver[n], signal->GetData(pOver[n]));
+        gr3[nGraphs]->SetPoint(point, signal->GetStartBin() + pOver[n], signal->GetData(pOver[n]));
         point++;
         if (n + 1 < nPoints && pOver[n + 1] - pOver[n] > 1) {
             gr3[nGraphs]->Draw("CP");
@@ -0,0 +1,365 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawSignalNoiseClassifierProcess identifies the signals of a
+/// TRestRawSignalEvent that contain only noise, using a pretrained classifier
+/// evaluated on a few features that are cheap to calculate. It is intended
+/// to be placed early in the processing chain, so that the noise channels
+/// can be removed before the more expensive per-channel processes, such as
+/// the threshold search, the fits or the channel activity histograms.
+///
+/// The baseline of each signal is calculated inside `baseLineRange`, and the
+/// following features are obtained in a single pass over the signal data:
+///
+/// * **0**, maximum over sigma: the maximum baseline corrected value divided
+/// by the baseline fluctuation.
+/// * **1**, integral: the sum of the baseline corrected values.
+/// * **2**, width: the number of points exceeding `pointThreshold` times the
+/// baseline fluctuation.
+/// * **3** and **4**, derivative extrema: the maximum and the minimum
+/// difference between consecutive points.
+///
+/// The features of all the signals in the event are stored in a feature-major
+/// matrix, and the classifier is evaluated for the whole event at once. Two
+/// classifier types are available through the `modelType` parameter, and
+/// their parameters are read from the tab separated table at `modelFile`:
+///
+/// * **linear**: a single row with the bias and the weight of each feature. The
+/// score is the bias plus the weighted sum of the features.
+/// * **trees**: an ensemble of decision trees, with one row per node containing
+/// the tree number, the feature index, the threshold, the left and right
+/// children and the value. The children are the node numbers inside the same
+/// tree, starting at 0 for the root, and the features lower or equal than the
+/// threshold follow the left child. Leaves have a negative feature index, and
+/// the score is the sum of the values of the leaves reached at each tree.
+///
+/// The signals with a score below `scoreThreshold` are classified as noise.
+///
+/// The different parameters allowed in this process are:
+///
+/// * **modelFile**: the file containing the classifier parameters.
+/// * **modelType**: the classifier type, linear or trees. Default is linear.
+/// * **scoreThreshold**: the minimum score of a physical signal. Default is 0.
+/// * **action**: tag, to only register the noise signals at the observables,
+/// or drop, to also remove them from the event. Default is tag.
+/// * **baseLineRange**: the range used to calculate the baseline. Default is
+/// (10,90).
+/// * **pointThreshold**: the threshold, in baseline sigmas, used for the width
+/// feature. Default is 3.
+/// * **signalsRange**: only the signals with ids inside this range are
+/// classified.
+///
+/// The following observables are available:
+///
+/// * **NumberOfNoiseSignals**: the number of signals classified as noise.
+/// * **noise_signal_ids**: the IDs of the signals classified as noise.
+/// * **classifier_score_map**: map the ID of each classified signal with its
+/// score.
+///
+/// \code
+///   <addProcess type="TRestRawSignalNoiseClassifierProcess" name="noise" value="ON" >
+///       <parameter name="modelFile" value="noiseClassifier.txt" />
+///       <parameter name="modelType" value="trees" />
+///       <parameter name="action" value="drop" />
+///       <parameter name="baseLineRange" value="(20,120)" />
+///       <observable name="NumberOfNoiseSignals" value="ON" />
+///   </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawSignalNoiseClassifierProcess
+///
+/// <hr>
+///
+#include "TRestRawSignalNoiseClassifierProcess.h"
+
+#include "TRestTools.h"
+
+using namespace std;
+
+ClassImp(TRestRawSignalNoiseClassifierProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawSignalNoiseClassifierProcess::TRestRawSignalNoiseClassifierProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawSignalNoiseClassifierProcess::TRestRawSignalNoiseClassifierProcess(const char* configFilename) {
+    Initialize();
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawSignalNoiseClassifierProcess::~TRestRawSignalNoiseClassifierProcess() {}
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawSignalNoiseClassifierProcess::Initialize() {
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fSignalEvent = nullptr;
+}
+
+///////////////////////////////////////////////
+/// \brief Process initialization. The classifier is loaded here.
+///
+void TRestRawSignalNoiseClassifierProcess::InitProcess() {
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1) fRangeEnabled = true;
+
+    if (fModelType != "linear" && fModelType != "trees") {
+        RESTError << "TRestRawSignalNoiseClassifierProcess. Model type : " << fModelType
+                  << " is not supported!" << RESTendl;
+        exit(1);
+    }
+
+    if (fAction != "tag" && fAction != "drop") {
+        RESTWarning << "TRestRawSignalNoiseClassifierProcess. Action : " << fAction
+                    << " is not supported. Noise signals will be only tagged." << RESTendl;
+        fAction = "tag";
+    }
+    fDropNoise = (fAction == "drop");
+
+    if (!LoadModel()) exit(1);
+}
+
+///////////////////////////////////////////////
+/// \brief It reads the classifier parameters from the model file. It returns
+/// false if the file is not found or the parameters are not valid.
+///
+Bool_t TRestRawSignalNoiseClassifierProcess::LoadModel() {
+    string fullPath = SearchFile((string)fModelFile);
+    vector<vector<Double_t>> table;
+    if (fullPath.empty() || !TRestTools::ReadASCIITable(fullPath, table) || table.empty()) {
+        RESTError << "TRestRawSignalNoiseClassifierProcess. Model file not found : " << fModelFile
+                  << RESTendl;
+        return false;
+    }
+
+    if (fModelType == "linear") {
+        if (table[0].size() != kNFeatures + 1) {
+            RESTError << "TRestRawSignalNoiseClassifierProcess. The linear model requires " << kNFeatures + 1
+                      << " parameters, but " << table[0].size() << " were found" << RESTendl;
+            return false;
+        }
+        fWeights = table[0];
+        return true;
+    }
+
+    fTreeRoots.clear();
+    fNodeFeature.clear();
+    fNodeThreshold.clear();
+    fNodeLeft.clear();
+    fNodeRight.clear();
+    fNodeValue.clear();
+    for (size_t n = 0; n < table.size(); n++) {
+        const vector<Double_t>& row = table[n];
+        if (row.size() != 6 || row[1] >= kNFeatures) {
+            RESTError << "TRestRawSignalNoiseClassifierProcess. Wrong tree node definition at row " << n
+                      << RESTendl;
+            return false;
+        }
+        if (n == 0 || row[0] != table[n - 1][0]) fTreeRoots.push_back(n);
+
+        // The children are converted into absolute node indexes
+        const Int_t root = fTreeRoots.back();
+        fNodeFeature.push_back((Int_t)row[1]);
+        fNodeThreshold.push_back(row[2]);
+        fNodeLeft.push_back(root + (Int_t)row[3]);
+        fNodeRight.push_back(root + (Int_t)row[4]);
+        fNodeValue.push_back(row[5]);
+    }
+
+    const Int_t nNodes = fNodeFeature.size();
+    for (size_t t = 0; t < fTreeRoots.size(); t++) {
+        const Int_t treeEnd = t + 1 < fTreeRoots.size() ? fTreeRoots[t + 1] : nNodes;
+        for (int n = fTreeRoots[t]; n < treeEnd; n++) {
+            if (fNodeFeature[n] < 0) continue;
+            // Children must follow their parent inside the same tree, so that the evaluation always
+            // finishes at a leaf of that tree
+            if (fNodeLeft[n] <= n || fNodeLeft[n] >= treeEnd || fNodeRight[n] <= n ||
+                fNodeRight[n] >= treeEnd) {
+                RESTError << "TRestRawSignalNoiseClassifierProcess. Wrong children at tree node " << n
+                          << RESTendl;
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////
+/// \brief It evaluates the linear model for all the signals at fFeatures
+///
+void TRestRawSignalNoiseClassifierProcess::EvaluateLinear(Int_t nSignals) {
+    fScores.assign(nSignals, fWeights[0]);
+    for (int f = 0; f < kNFeatures; f++) {
+        const Double_t weight = fWeights[f + 1];
+        const Float_t* feature = &fFeatures[(size_t)f * nSignals];
+        for (int s = 0; s < nSignals; s++) fScores[s] += weight * feature[s];
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief It evaluates the decision tree ensemble for all the signals at
+/// fFeatures
+///
+void TRestRawSignalNoiseClassifierProcess::EvaluateTrees(Int_t nSignals) {
+    fScores.assign(nSignals, 0);
+    for (const auto& root : fTreeRoots) {
+        for (int s = 0; s < nSignals; s++) {
+            Int_t node = root;
+            while (fNodeFeature[node] >= 0)
+                node = fFeatures[(size_t)fNodeFeature[node] * nSignals + s] <= fNodeThreshold[node]
+                           ? fNodeLeft[node]
+                           : fNodeRight[node];
+            fScores[s] += fNodeValue[node];
+        }
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function
+///
+TRestEvent* TRestRawSignalNoiseClassifierProcess::ProcessEvent(TRestEvent* inputEvent) {
+    fSignalEvent = (TRestRawSignalEvent*)inputEvent;
+
+    vector<TRestRawSignal*> signals;
+    for (int s = 0; s < fSignalEvent->GetNumberOfSignals(); s++) {
+        TRestRawSignal* sgnl = fSignalEvent->GetSignal(s);
+
+        if (fRangeEnabled && (sgnl->GetID() < fSignalsRange.X() || sgnl->GetID() > fSignalsRange.Y()))
+            continue;
+
+        signals.push_back(sgnl);
+    }
+
+    const Int_t nSignals = signals.size();
+    fFeatures.resize((size_t)kNFeatures * nSignals);
+    for (int s = 0; s < nSignals; s++) {
+        TRestRawSignal* sgnl = signals[s];
+        sgnl->CalculateBaseLine(fBaseLineRange.X(), fBaseLineRange.Y());
+
+        const Double_t baseLine = sgnl->GetBaseLine();
+        const Double_t threshold = baseLine + fPointThreshold * sgnl->GetBaseLineSigma();
+        Double_t maxValue = 0, integral = 0, maxDerivative = 0, minDerivative = 0;
+        Int_t width = 0;
+        const Int_t nPoints = sgnl->GetNumberOfPoints();
+        for (int n = 0; n < nPoints; n++) {
+            const Double_t value = sgnl->GetRawData(n);
+            if (n == 0 || value > maxValue) maxValue = value;
+            integral += value;
+            width += value > threshold;
+            if (n > 0) {
+                const Double_t derivative = value - sgnl->GetRawData(n - 1);
+                maxDerivative = max(maxDerivative, derivative);
+                minDerivative = min(minDerivative, derivative);
+            }
+        }
+
+        const Double_t sigma = sgnl->GetBaseLineSigma();
+        fFeatures[(size_t)kMaxOverSigma * nSignals + s] = sigma > 0 ? (maxValue - baseLine) / sigma : 0;
+        fFeatures[(size_t)kIntegral * nSignals + s] = integral - nPoints * baseLine;
+        fFeatures[(size_t)kWidth * nSignals + s] = width;
+        fFeatures[(size_t)kMaxDerivative * nSignals + s] = maxDerivative;
+        fFeatures[(size_t)kMinDerivative * nSignals + s] = minDerivative;
+    }
+
+    if (fModelType == "linear")
+        EvaluateLinear(nSignals);
+    else
+        EvaluateTrees(nSignals);
+
+    map<int, Double_t> scores;
+    fNoiseIds.clear();
+    for (int s = 0; s < nSignals; s++) {
+        scores[signals[s]->GetID()] = fScores[s];
+        if (fScores[s] < fScoreThreshold) fNoiseIds.push_back(signals[s]->GetID());
+    }
+
+    if (fDropNoise)
+        for (const auto& id : fNoiseIds) fSignalEvent->RemoveSignalWithId(id);
+
+    SetObservableValue("NumberOfNoiseSignals", (Int_t)fNoiseIds.size());
+    SetObservableValue("noise_signal_ids", fNoiseIds);
+    SetObservableValue("classifier_score_map", scores);
+
+    RESTDebug << "TRestRawSignalNoiseClassifierProcess. Event " << fSignalEvent->GetID() << " : "
+              << fNoiseIds.size() << " noise signals out of " << nSignals << RESTendl;
+
+    return fSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints out the process parameters stored in the metadata structure
+///
+void TRestRawSignalNoiseClassifierProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Model file : " << fModelFile << RESTendl;
+    RESTMetadata << "Model type : " << fModelType << RESTendl;
+    if (fModelType == "trees")
+        RESTMetadata << "Number of trees : " << fTreeRoots.size() << " with " << fNodeFeature.size()
+                     << " nodes" << RESTendl;
+    RESTMetadata << "Score threshold : " << fScoreThreshold << RESTendl;
+    RESTMetadata << "Action : " << fAction << RESTendl;
+    RESTMetadata << "Baseline range : (" << fBaseLineRange.X() << ", " << fBaseLineRange.Y() << ")"
+                 << RESTendl;
+    RESTMetadata << "Point threshold : " << fPointThreshold << " sigmas" << RESTendl;
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1)
+        RESTMetadata << "Signals range : (" << fSignalsRange.X() << ", " << fSignalsRange.Y() << ")"
+                     << RESTendl;
+
+    EndPrintProcess();
+}
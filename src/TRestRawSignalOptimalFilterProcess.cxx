@@ -0,0 +1,456 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawSignalOptimalFilterProcess estimates the pulse amplitude of
+/// each signal inside the input TRestRawSignalEvent using the optimal, or
+/// matched, filter. The amplitude is the one of the pulse template that
+/// best describes the signal, weighting each frequency with the inverse of
+/// the noise power. It is the amplitude estimator with the lowest variance
+/// for a known pulse shape and a stationary noise, and it is obtained at a
+/// small fraction of the cost of a fit to the signal.
+///
+/// The template is read from the object named `templateName` inside the ROOT
+/// file `templateFile`. It may be the TRestRawSignalTemplateBuilderProcess
+/// that built the template in a previous run, whose global template is used,
+/// or a TRestRawSignal, as the one produced by the macro
+/// REST_Raw_ProduceResponseSignal.C. It is normalized to unit amplitude, so
+/// that the amplitude obtained is the pulse height, baseline corrected, in
+/// ADC units. The signals are required to have the same number of samples
+/// as the template.
+///
+/// The filter weights of each channel are calculated once, at InitProcess.
+/// Each signal is then transformed with a single FFT, whose transform is kept
+/// by TRestRawFFT between events, and the amplitude is the dot product of the
+/// signal spectrum with the weights of its channel. If `timeSearch` is
+/// enabled, an additional inverse FFT is used to obtain the amplitude for
+/// every time shift of the template, and the maximum is taken. The frequency
+/// zero is not used, so that the result does not depend on the baseline.
+///
+/// The noise power spectrum of each channel is accumulated during the run,
+/// using the signals whose amplitude is below `noiseThreshold` times the
+/// baseline fluctuation, and it is stored with the process metadata. The
+/// spectra accumulated by each thread are merged at EndProcess, see
+/// TRestRawThreadSums, so that the spectra of the whole run are stored. The
+/// spectra of a previous run are used to calculate the weights when the file
+/// produced by that run is given as `noiseFile`. The channels not found in
+/// that file use the average spectrum of all the channels. If `noiseFile` is
+/// not given a white noise is assumed, and the filter reduces to the
+/// correlation with the template.
+///
+/// The different parameters allowed in this process are:
+///
+/// * **templateFile**: the ROOT file containing the template.
+/// * **templateName**: the name of the template, or of the template builder
+/// process. Default is "signal Response".
+/// * **noiseFile**: a ROOT file written by a previous run with this process.
+/// * **timeSearch**: if true the time shift of the template is optimized.
+/// Default is false.
+/// * **baseLineRange**: the range used to calculate the baseline fluctuation.
+/// Default is (10,90).
+/// * **noiseThreshold**: the maximum amplitude, in baseline sigmas, of the
+/// signals used to estimate the noise spectrum. Default is 4.
+///
+/// The observables defined by this process are:
+///
+/// * **amplitude_map**: the amplitude of each signal, by signal id.
+/// * **time_map**: the time bin where the fitted template reaches its
+/// maximum, by signal id. Only if `timeSearch` is enabled.
+/// * **TotalAmplitude**: the sum of the amplitudes of all the signals.
+/// * **MaxAmplitude**: the highest amplitude of the event.
+///
+/// \code
+///   <addProcess type="TRestRawSignalOptimalFilterProcess" name="optimalFilter" value="ON" >
+///       <parameter name="templateFile" value="response.root" />
+///       <parameter name="noiseFile" value="R01234_noise.root" />
+///       <parameter name="timeSearch" value="true" />
+///       <observable name="amplitude_map" value="ON" />
+///       <observable name="MaxAmplitude" value="ON" />
+///   </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawSignalOptimalFilterProcess
+///
+/// <hr>
+///
+#include "TRestRawSignalOptimalFilterProcess.h"
+
+#include <TFile.h>
+#include <TMath.h>
+
+#include <algorithm>
+
+#include "TRestRawSignalTemplateBuilderProcess.h"
+#include "TRestRawThreadSums.h"
+
+using namespace std;
+
+ClassImp(TRestRawSignalOptimalFilterProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawSignalOptimalFilterProcess::TRestRawSignalOptimalFilterProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawSignalOptimalFilterProcess::TRestRawSignalOptimalFilterProcess(const char* configFilename) {
+    Initialize();
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawSignalOptimalFilterProcess::~TRestRawSignalOptimalFilterProcess() {
+    TRestRawThreadSums::Unregister(this);
+}
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawSignalOptimalFilterProcess::Initialize() {
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fSignalEvent = nullptr;
+}
+
+///////////////////////////////////////////////
+/// \brief Process initialization. The template and the noise spectra are
+/// loaded, and the filter weights of each channel are calculated. The instance
+/// is registered to merge its noise spectra at EndProcess.
+///
+void TRestRawSignalOptimalFilterProcess::InitProcess() {
+    fNoiseSpectra.clear();
+    fNoiseEntries.clear();
+    fWeightsReal.clear();
+    fWeightsImg.clear();
+    fLengthWarning = false;
+
+    TRestRawThreadSums::Register(GetName(), this, [this](const TRestRawThreadSums::Sums& sums) {
+        fNoiseSpectra.clear();
+        fNoiseEntries.clear();
+        if (sums.count("spectra")) fNoiseSpectra = sums.at("spectra");
+        if (sums.count("entries"))
+            for (const auto& entries : sums.at("entries")) fNoiseEntries[entries.first] = entries.second[0];
+    });
+
+    if (!LoadTemplate()) return;
+
+    LoadNoiseSpectra();
+
+    // The default weights use the average noise of all the channels, or white noise
+    vector<Double_t> averagePower(fNfft / 2 + 1, 0);
+    for (const auto& power : fNoisePower)
+        for (int k = 0; k <= fNfft / 2; k++) averagePower[k] += power.second[k] / fNoisePower.size();
+    if (fNoisePower.empty()) averagePower.assign(fNfft / 2 + 1, 1);
+
+    CalculateWeights(-1, averagePower);
+    for (const auto& power : fNoisePower) CalculateWeights(power.first, power.second);
+
+    RESTDebug << "TRestRawSignalOptimalFilterProcess. Weights calculated for " << fWeightsReal.size()
+              << " channels" << RESTendl;
+}
+
+///////////////////////////////////////////////
+/// \brief It loads the template from the template file and calculates its
+/// spectrum. It returns false if the template could not be loaded.
+///
+Bool_t TRestRawSignalOptimalFilterProcess::LoadTemplate() {
+    fNfft = 0;
+
+    string fullPath = SearchFile((string)fTemplateFile);
+    TFile* file = fullPath.empty() ? nullptr : TFile::Open(fullPath.c_str());
+    if (file == nullptr || file->IsZombie()) {
+        RESTError << "TRestRawSignalOptimalFilterProcess. Template file not found : " << fTemplateFile
+                  << RESTendl;
+        return false;
+    }
+
+    // The template may be a TRestRawSignal, or the global template built by a template builder process
+    TObject* object = file->Get(fTemplateName);
+    vector<Double_t> pulse;
+    if (object != nullptr && object->InheritsFrom("TRestRawSignalTemplateBuilderProcess")) {
+        vector<Float_t> builderTemplate = ((TRestRawSignalTemplateBuilderProcess*)object)->GetTemplate();
+        pulse.assign(builderTemplate.begin(), builderTemplate.end());
+    } else if (object != nullptr && object->InheritsFrom("TRestRawSignal")) {
+        TRestRawSignal* templateSignal = (TRestRawSignal*)object;
+        for (int n = 0; n < templateSignal->GetNumberOfPoints(); n++)
+            pulse.push_back(templateSignal->GetRawData(n));
+    }
+    delete object;
+
+    file->Close();
+    delete file;
+
+    if (pulse.size() < 2) {
+        RESTError << "TRestRawSignalOptimalFilterProcess. Template " << fTemplateName << " not found in "
+                  << fTemplateFile << RESTendl;
+        return false;
+    }
+    fNfft = pulse.size();
+
+    fTemplatePeakBin = std::max_element(pulse.begin(), pulse.end()) - pulse.begin();
+    const Double_t amplitude = pulse[fTemplatePeakBin];
+    if (amplitude <= 0) {
+        RESTError << "TRestRawSignalOptimalFilterProcess. The template has no positive amplitude" << RESTendl;
+        fNfft = 0;
+        return false;
+    }
+
+    // The template spectrum is calculated only once, directly, to keep its full precision
+    fTemplateReal.assign(fNfft / 2 + 1, 0);
+    fTemplateImg.assign(fNfft / 2 + 1, 0);
+    for (int k = 0; k <= fNfft / 2; k++) {
+        for (int n = 0; n < fNfft; n++) {
+            const Double_t phase = 2 * TMath::Pi() * k * n / fNfft;
+            fTemplateReal[k] += pulse[n] / amplitude * TMath::Cos(phase);
+            fTemplateImg[k] -= pulse[n] / amplitude * TMath::Sin(phase);
+        }
+    }
+
+    return true;
+}
+
+///////////////////////////////////////////////
+/// \brief It loads the noise spectra accumulated by this process in a
+/// previous run, which was written to fNoiseFile.
+///
+void TRestRawSignalOptimalFilterProcess::LoadNoiseSpectra() {
+    fNoisePower.clear();
+    if (fNoiseFile == "") return;
+
+    string fullPath = SearchFile((string)fNoiseFile);
+    TFile* file = fullPath.empty() ? nullptr : TFile::Open(fullPath.c_str());
+    if (file == nullptr || file->IsZombie()) {
+        RESTWarning << "TRestRawSignalOptimalFilterProcess. Noise file not found : " << fNoiseFile
+                    << ". White noise will be assumed." << RESTendl;
+        return;
+    }
+
+    TRestRawSignalOptimalFilterProcess* previous = (TRestRawSignalOptimalFilterProcess*)file->Get(GetName());
+    if (previous == nullptr) {
+        RESTWarning << "TRestRawSignalOptimalFilterProcess. Process " << GetName() << " not found in "
+                    << fNoiseFile << ". White noise will be assumed." << RESTendl;
+    } else {
+        for (const auto& spectrum : previous->GetNoiseSpectra()) {
+            vector<Double_t> power = previous->GetNoiseSpectrum(spectrum.first);
+            if ((Int_t)power.size() == fNfft / 2 + 1) fNoisePower[spectrum.first] = power;
+        }
+        RESTInfo << "TRestRawSignalOptimalFilterProcess. Noise spectra loaded for " << fNoisePower.size()
+                 << " channels" << RESTendl;
+        delete previous;
+    }
+
+    file->Close();
+    delete file;
+}
+
+///////////////////////////////////////////////
+/// \brief It calculates the filter weights of a channel from its noise
+/// power spectrum.
+///
+/// The weight of each frequency is the complex conjugate of the template
+/// spectrum divided by the noise power, normalized so that the filter output
+/// is the template amplitude. The factor 2 of the frequencies appearing twice
+/// in the spectrum of a real signal is included.
+///
+void TRestRawSignalOptimalFilterProcess::CalculateWeights(Int_t channel, const vector<Double_t>& noisePower) {
+    vector<Double_t>& weightsReal = fWeightsReal[channel];
+    vector<Double_t>& weightsImg = fWeightsImg[channel];
+    weightsReal.assign(fNfft / 2 + 1, 0);
+    weightsImg.assign(fNfft / 2 + 1, 0);
+
+    Double_t norm = 0;
+    for (int k = 1; k <= fNfft / 2; k++) {
+        if (noisePower[k] <= 0) continue;
+        const Double_t multiplicity = (2 * k == fNfft) ? 1 : 2;
+        weightsReal[k] = multiplicity * fTemplateReal[k] / noisePower[k];
+        weightsImg[k] = -multiplicity * fTemplateImg[k] / noisePower[k];
+        norm += weightsReal[k] * fTemplateReal[k] - weightsImg[k] * fTemplateImg[k];
+    }
+
+    if (norm <= 0) return;
+    for (int k = 1; k <= fNfft / 2; k++) {
+        weightsReal[k] /= norm;
+        weightsImg[k] /= norm;
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the noise power spectrum of the given channel accumulated
+/// during the run, averaged over the number of signals used.
+///
+vector<Double_t> TRestRawSignalOptimalFilterProcess::GetNoiseSpectrum(Int_t channel) const {
+    vector<Double_t> spectrum;
+    if (fNoiseSpectra.count(channel) == 0 || fNoiseEntries.at(channel) == 0) return spectrum;
+
+    spectrum = fNoiseSpectra.at(channel);
+    for (auto& power : spectrum) power /= fNoiseEntries.at(channel);
+    return spectrum;
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function
+///
+TRestEvent* TRestRawSignalOptimalFilterProcess::ProcessEvent(TRestEvent* inputEvent) {
+    fSignalEvent = (TRestRawSignalEvent*)inputEvent;
+
+    fAmplitudes.clear();
+    fTimes.clear();
+    Double_t totalAmplitude = 0;
+    Double_t maxAmplitude = 0;
+
+    const Int_t nFrequencies = fNfft / 2 + 1;
+    for (int s = 0; fNfft > 0 && s < fSignalEvent->GetNumberOfSignals(); s++) {
+        TRestRawSignal* sgnl = fSignalEvent->GetSignal(s);
+
+        if (sgnl->GetNumberOfPoints() != fNfft) {
+            if (!fLengthWarning) {
+                RESTWarning << "TRestRawSignalOptimalFilterProcess. Signals with "
+                            << sgnl->GetNumberOfPoints() << " points do not match the template with " << fNfft
+                            << " points. They will be ignored." << RESTendl;
+                fLengthWarning = true;
+            }
+            continue;
+        }
+
+        sgnl->CalculateBaseLine(fBaseLineRange.X(), fBaseLineRange.Y(), "ROBUST");
+        fFFT.ForwardSignalFFT(sgnl);
+
+        const Int_t id = sgnl->GetID();
+        if (sgnl->GetBaseLineSigma() > 0 &&
+            sgnl->GetMaxPeakValue() < fNoiseThreshold * sgnl->GetBaseLineSigma()) {
+            vector<Double_t>& spectrum = fNoiseSpectra[id];
+            spectrum.resize(nFrequencies, 0);
+            for (int k = 0; k < nFrequencies; k++) spectrum[k] += fFFT.GetFrequencyNorm2(k);
+            fNoiseEntries[id]++;
+        }
+
+        const Int_t channel = fWeightsReal.count(id) ? id : -1;
+        const Double_t* weightsReal = fWeightsReal[channel].data();
+        const Double_t* weightsImg = fWeightsImg[channel].data();
+
+        Double_t amplitude = 0;
+        if (!fTimeSearch) {
+            for (int k = 1; k < nFrequencies; k++)
+                amplitude += fFFT.GetFrequencyAmplitudeReal(k) * weightsReal[k] -
+                             fFFT.GetFrequencyAmplitudeImg(k) * weightsImg[k];
+        } else {
+            // The filter output for every time shift, with the frequency multiplicity removed
+            for (int k = 0; k < nFrequencies; k++) {
+                const Double_t xr = fFFT.GetFrequencyAmplitudeReal(k);
+                const Double_t xi = fFFT.GetFrequencyAmplitudeImg(k);
+                const Double_t multiplicity = (k == 0 || 2 * k == fNfft) ? 1 : 2;
+                fFFT.SetNode(k, (xr * weightsReal[k] - xi * weightsImg[k]) / multiplicity,
+                             (xr * weightsImg[k] + xi * weightsReal[k]) / multiplicity);
+            }
+            fFFT.BackwardFFT();
+
+            Int_t shift = 0;
+            amplitude = fFFT.GetTimeAmplitudeReal(0);
+            for (int n = 1; n < fNfft; n++) {
+                if (fFFT.GetTimeAmplitudeReal(n) > amplitude) {
+                    amplitude = fFFT.GetTimeAmplitudeReal(n);
+                    shift = n;
+                }
+            }
+            amplitude *= fNfft;
+
+            if (shift > fNfft / 2) shift -= fNfft;
+            fTimes[id] = fTemplatePeakBin + shift;
+        }
+
+        fAmplitudes[id] = amplitude;
+        totalAmplitude += amplitude;
+        if (amplitude > maxAmplitude) maxAmplitude = amplitude;
+    }
+
+    SetObservableValue("amplitude_map", fAmplitudes);
+    if (fTimeSearch) SetObservableValue("time_map", fTimes);
+    SetObservableValue("TotalAmplitude", totalAmplitude);
+    SetObservableValue("MaxAmplitude", maxAmplitude);
+
+    return fSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief Function to include required actions after all events have been
+/// processed. The noise spectra of this instance are merged with the spectra
+/// of the other threads.
+///
+void TRestRawSignalOptimalFilterProcess::EndProcess() {
+    TRestRawThreadSums::Sums sums;
+    for (const auto& spectrum : fNoiseSpectra) {
+        sums["spectra"][spectrum.first] = spectrum.second;
+        sums["entries"][spectrum.first] = {(Double_t)fNoiseEntries[spectrum.first]};
+    }
+    if (!TRestRawThreadSums::Merge(GetName(), this, sums)) return;
+
+    RESTInfo << "TRestRawSignalOptimalFilterProcess. Noise spectra accumulated for " << fNoiseSpectra.size()
+             << " channels" << RESTendl;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints out the process parameters stored in the metadata structure
+///
+void TRestRawSignalOptimalFilterProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Template : " << fTemplateName << " from " << fTemplateFile << RESTendl;
+    if (fNfft > 0) RESTMetadata << "Template points : " << fNfft << RESTendl;
+    if (fNoiseFile != "") RESTMetadata << "Noise file : " << fNoiseFile << RESTendl;
+    RESTMetadata << "Time search : " << (fTimeSearch ? "true" : "false") << RESTendl;
+    RESTMetadata << "Baseline range : (" << fBaseLineRange.X() << ", " << fBaseLineRange.Y() << ")"
+                 << RESTendl;
+    RESTMetadata << "Noise threshold : " << fNoiseThreshold << " sigmas" << RESTendl;
+    RESTMetadata << "Channels with noise spectrum : " << fNoiseSpectra.size() << RESTendl;
+
+    EndPrintProcess();
+}
@@ -0,0 +1,236 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawSignalROICropProcess reduces the size of the output by
+/// cropping each signal of the input TRestRawSignalEvent to a region of
+/// interest around its pulse. Most of the acquisition window is usually
+/// filled with baseline, so that cropping the signals right after the
+/// acquisition reduces considerably the size of the stored raw data.
+///
+/// Two definitions of the region of interest are available through the
+/// `mode` parameter:
+///
+/// * **peak**: the signal is cropped to [peak - preSamples, peak + postSamples],
+/// where peak is the bin of the maximum of the signal.
+/// * **threshold**: the points over threshold are identified, as in
+/// TRestRawSignalAnalysisProcess, and the signal is cropped to the range
+/// covering all of them, extended by `preSamples` before the first point and
+/// `postSamples` after the last one. The signals without points over
+/// threshold are not cropped, or removed if `removeEmptySignals` is true.
+///
+/// The signals are modified in place, and the input event is returned. The
+/// bin of the first remaining point in the original acquisition window is
+/// stored in the signal, see TRestRawSignal::Crop and
+/// TRestRawSignal::GetStartBin, and it is taken into account by the time
+/// observables of TRestRawSignalAnalysisProcess and when drawing the event.
+/// Since the other parameters of the downstream processes, such as their
+/// baseline range, are given in bins of the cropped signals, `preSamples`
+/// should be large enough to keep the baseline region in front of the pulse.
+///
+/// The different parameters allowed in this process are:
+///
+/// * **mode**: the definition of the region of interest, peak or threshold.
+/// Default is peak.
+/// * **preSamples**: the number of points kept before the peak, or before the
+/// first point over threshold. Default is 64.
+/// * **postSamples**: the number of points kept after the peak, or after the
+/// last point over threshold. Default is 128.
+/// * **baseLineRange**: the range used to calculate the baseline in threshold
+/// mode. Default is (10,90).
+/// * **pointThreshold**, **signalThreshold** and **pointsOverThreshold**: the
+/// points over threshold definition, in baseline sigmas, as in
+/// TRestRawSignalAnalysisProcess. Defaults are 3, 5 and 5.
+/// * **removeEmptySignals**: if true, the signals without points over threshold
+/// are removed from the event in threshold mode. Default is false.
+/// * **signalsRange**: only the signals with ids inside this range are
+/// processed.
+///
+/// The number of points removed from the event is registered in the
+/// `croppedPoints` observable, and the number of signals removed in the
+/// `removedSignals` observable.
+///
+/// \code
+///   <addProcess type="TRestRawSignalROICropProcess" name="crop" value="ON" >
+///       <parameter name="mode" value="threshold" />
+///       <parameter name="preSamples" value="100" />
+///       <parameter name="postSamples" value="50" />
+///       <parameter name="baseLineRange" value="(20,120)" />
+///       <parameter name="removeEmptySignals" value="true" />
+///       <observable name="croppedPoints" value="ON" />
+///   </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawSignalROICropProcess
+///
+/// <hr>
+///
+#include "TRestRawSignalROICropProcess.h"
+
+using namespace std;
+
+ClassImp(TRestRawSignalROICropProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawSignalROICropProcess::TRestRawSignalROICropProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawSignalROICropProcess::TRestRawSignalROICropProcess(const char* configFilename) {
+    Initialize();
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawSignalROICropProcess::~TRestRawSignalROICropProcess() {}
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawSignalROICropProcess::Initialize() {
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fSignalEvent = nullptr;
+}
+
+///////////////////////////////////////////////
+/// \brief Process initialization
+///
+void TRestRawSignalROICropProcess::InitProcess() {
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1) fRangeEnabled = true;
+
+    if (fMode != "peak" && fMode != "threshold") {
+        RESTWarning << "TRestRawSignalROICropProcess. Mode : " << fMode
+                    << " is not supported. Using peak mode." << RESTendl;
+        fMode = "peak";
+    }
+    fThresholdMode = (fMode == "threshold");
+
+    if (fPreSamples < 0) fPreSamples = 0;
+    if (fPostSamples < 0) fPostSamples = 0;
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function
+///
+TRestEvent* TRestRawSignalROICropProcess::ProcessEvent(TRestEvent* inputEvent) {
+    fSignalEvent = (TRestRawSignalEvent*)inputEvent;
+
+    Int_t croppedPoints = 0;
+    vector<Int_t> emptySignals;
+    for (int s = 0; s < fSignalEvent->GetNumberOfSignals(); s++) {
+        TRestRawSignal* sgnl = fSignalEvent->GetSignal(s);
+
+        if (fRangeEnabled && (sgnl->GetID() < fSignalsRange.X() || sgnl->GetID() > fSignalsRange.Y()))
+            continue;
+
+        const Int_t nPoints = sgnl->GetNumberOfPoints();
+
+        Int_t first, last;
+        if (fThresholdMode) {
+            sgnl->CalculateBaseLine(fBaseLineRange.X(), fBaseLineRange.Y());
+            sgnl->InitializePointsOverThreshold(TVector2(fPointThreshold, fSignalThreshold),
+                                                fPointsOverThreshold);
+
+            const vector<Int_t>& points = sgnl->GetPointsOverThreshold();
+            if (points.empty()) {
+                if (fRemoveEmptySignals) emptySignals.push_back(sgnl->GetID());
+                continue;
+            }
+            first = points.front();
+            last = points.back();
+        } else {
+            first = last = sgnl->GetMaxPeakBin();
+        }
+
+        sgnl->Crop(first - fPreSamples, last + fPostSamples + 1);
+        croppedPoints += nPoints - sgnl->GetNumberOfPoints();
+    }
+
+    for (const auto& id : emptySignals) {
+        croppedPoints += fSignalEvent->GetSignalById(id)->GetNumberOfPoints();
+        fSignalEvent->RemoveSignalWithId(id);
+    }
+
+    SetObservableValue("croppedPoints", croppedPoints);
+    SetObservableValue("removedSignals", (Int_t)emptySignals.size());
+
+    RESTDebug << "TRestRawSignalROICropProcess. Event " << fSignalEvent->GetID() << " : " << croppedPoints
+              << " points cropped, " << emptySignals.size() << " signals removed" << RESTendl;
+
+    return fSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints out the process parameters stored in the metadata structure
+///
+void TRestRawSignalROICropProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Mode : " << fMode << RESTendl;
+    RESTMetadata << "Pre samples : " << fPreSamples << RESTendl;
+    RESTMetadata << "Post samples : " << fPostSamples << RESTendl;
+    if (fThresholdMode) {
+        RESTMetadata << "Baseline range : (" << fBaseLineRange.X() << ", " << fBaseLineRange.Y() << ")"
+                     << RESTendl;
+        RESTMetadata << "Point threshold : " << fPointThreshold << " sigmas" << RESTendl;
+        RESTMetadata << "Signal threshold : " << fSignalThreshold << " sigmas" << RESTendl;
+        RESTMetadata << "Number of points over threshold : " << fPointsOverThreshold << RESTendl;
+        RESTMetadata << "Remove empty signals : " << (fRemoveEmptySignals ? "true" : "false") << RESTendl;
+    }
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1)
+        RESTMetadata << "Signals range : (" << fSignalsRange.X() << ", " << fSignalsRange.Y() << ")"
+                     << RESTendl;
+
+    EndPrintProcess();
+}
@@ -82,6 +82,7 @@ TRestEvent* TRestRawSignalRangeReductionProcess::ProcessEvent(TRestEvent* inputE
         const TRestRawSignal* inputSignal = fInputRawSignalEvent->GetSignal(n);
         TRestRawSignal signal;
         signal.SetSignalID(inputSignal->GetSignalID());
+        signal.SetStartBin(inputSignal->GetStartBin());
 
         for (int i = 0; i < inputSignal->GetNumberOfPoints(); i++) {
             const Double_t value = (Double_t)inputSignal->GetData(i);
@@ -166,8 +166,6 @@ TRestEvent* TRestRawSignalRecoverChannelsProcess::ProcessEvent(TRestEvent* evInp
     for (int n = 0; n < fInputSignalEvent->GetNumberOfSignals(); n++)
         fOutputSignalEvent->AddSignal(*fInputSignalEvent->GetSignal(n));
 
-    Int_t nPoints = fOutputSignalEvent->GetSignal(0)->GetNumberOfPoints();
-
     Int_t idL;
     Int_t idR;
     for (unsigned int x = 0; x < fChannelIds.size(); x++) {
@@ -184,22 +182,35 @@ TRestEvent* TRestRawSignalRecoverChannelsProcess::ProcessEvent(TRestEvent* evInp
 
         if (leftSgnl == nullptr && rightSgnl == nullptr) continue;
 
+        // The recovered signal spans the acquisition window of the neighbour signals, which might have
+        // been cropped. Samples are matched by their bin in the original acquisition window.
+        const TRestRawSignal* reference = leftSgnl != nullptr ? leftSgnl : rightSgnl;
+        Int_t startBin = reference->GetStartBin();
+        Int_t nPoints = reference->GetNumberOfPoints();
+
         TRestRawSignal* recoveredSignal = new TRestRawSignal();
         recoveredSignal->SetID(fChannelIds[x]);
-
-        vector<Short_t> dataRecovered(nPoints);
-        for (int n = 0; n < nPoints; n++) dataRecovered[n] = 0;
-
-        if (leftSgnl != nullptr) {
-            for (int n = 0; n < nPoints; n++) dataRecovered[n] = leftSgnl->GetData(n);
+        recoveredSignal->SetStartBin(startBin);
+
+        vector<Float_t> dataRecovered(nPoints, 0);
+        for (const TRestRawSignal* neighbour : {leftSgnl, rightSgnl}) {
+            if (neighbour == nullptr) continue;
+            Int_t offset = startBin - neighbour->GetStartBin();
+            for (int n = 0; n < nPoints; n++) {
+                if (n + offset < 0 || n + offset >= neighbour->GetNumberOfPoints()) continue;
+                dataRecovered[n] += neighbour->GetData(n + offset);
+            }
         }
 
-        if (rightSgnl != nullptr) {
-            for (int n = 0; n < nPoints; n++) dataRecovered[n] += rightSgnl->GetData(n);
+        Bool_t isFloat = (leftSgnl != nullptr && leftSgnl->IsFloat()) ||
+                         (rightSgnl != nullptr && rightSgnl->IsFloat());
+        for (int n = 0; n < nPoints; n++) {
+            if (isFloat)
+                recoveredSignal->AddFloatPoint(dataRecovered[n] / 2.);
+            else
+                recoveredSignal->AddPoint(dataRecovered[n] / 2.);
         }
 
-        for (int n = 0; n < nPoints; n++) recoveredSignal->AddPoint(dataRecovered[n] / 2.);
-
         fOutputSignalEvent->AddSignal(*recoveredSignal);
 
         delete recoveredSignal;
@@ -0,0 +1,361 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawSignalRecursiveFilterProcess applies recursive, or infinite
+/// impulse response (IIR), digital filters to the signals found inside the
+/// input TRestRawSignalEvent. Contrary to the direct convolution used by
+/// TRestRawSignalShapingProcess, or the FFT based filters in TRestRawFFT,
+/// each output sample is obtained from a few previous samples, so that the
+/// cost per sample does not depend on the shaping time.
+///
+/// The filter coefficients are calculated once at InitProcess. The samples of
+/// all the signals in the event are arranged in a matrix where consecutive
+/// signals are contiguous in memory for a given time bin. The recursion runs
+/// over the time bins while the inner loop, running over the signals, has no
+/// dependencies and it is vectorized by the compiler.
+///
+/// The different filter types are:
+///
+/// * **crrc**: a CR differentiator followed by `order` RC integrators, all with
+/// time constant `shapingTime`.
+/// * **poleZero**: it cancels the exponential decay, with `decayTime`, of the
+/// input pulses, transforming them into steps.
+/// * **trapezoidal**: the trapezoidal shaper of Jordanov and Knoll, with
+/// `riseTime` and `flatTop` lengths. If `decayTime` is given, the exponential
+/// decay of the input pulses is corrected, otherwise input steps are assumed.
+///
+/// The filter response is normalized so that a unit input step, or a unit
+/// exponential pulse if `decayTime` is given, produces a unit amplitude
+/// output, which is then scaled by `gain`.
+///
+/// The different parameters allowed in this process are:
+///
+/// * **filterType**: crrc, poleZero or trapezoidal. Default is crrc.
+/// * **shapingTime**: the CR and RC time constant in bins. Default is 10.
+/// * **order**: the number of RC stages. Default is 4.
+/// * **decayTime**: the decay time of the input pulses in bins.
+/// * **riseTime**: the trapezoid rise time in bins. Default is 10.
+/// * **flatTop**: the trapezoid flat top in bins. Default is 5.
+/// * **gain**: a factor to amplify or attenuate the signal. Default is 1.
+/// * **baseLineRange**: the baseline calculated in this range is subtracted
+/// before filtering. The output signals have zero baseline.
+/// * **signalsRange**: only the signals with ids inside this range are
+/// filtered, the others are copied unchanged.
+///
+/// \code
+///   <addProcess type="TRestRawSignalRecursiveFilterProcess" name="trapezoid" value="ON" >
+///       <parameter name="filterType" value="trapezoidal" />
+///       <parameter name="riseTime" value="20" />
+///       <parameter name="flatTop" value="10" />
+///       <parameter name="decayTime" value="150" />
+///       <parameter name="baseLineRange" value="(10,60)" />
+///   </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawSignalRecursiveFilterProcess
+///
+/// <hr>
+///
+#include "TRestRawSignalRecursiveFilterProcess.h"
+
+#include <TMath.h>
+
+using namespace std;
+
+ClassImp(TRestRawSignalRecursiveFilterProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawSignalRecursiveFilterProcess::TRestRawSignalRecursiveFilterProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawSignalRecursiveFilterProcess::TRestRawSignalRecursiveFilterProcess(const char* configFilename) {
+    Initialize();
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawSignalRecursiveFilterProcess::~TRestRawSignalRecursiveFilterProcess() { delete fOutputSignalEvent; }
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawSignalRecursiveFilterProcess::Initialize() {
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fInputSignalEvent = nullptr;
+    fOutputSignalEvent = new TRestRawSignalEvent();
+}
+
+///////////////////////////////////////////////
+/// \brief Process initialization. The filter coefficients are calculated, and
+/// the filter response to a reference pulse is used to obtain the output
+/// normalization.
+///
+void TRestRawSignalRecursiveFilterProcess::InitProcess() {
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1) fRangeEnabled = true;
+
+    if (fShapingTime <= 0) fShapingTime = 1;
+    if (fOrder < 0) fOrder = 0;
+    if (fRiseTime < 1) fRiseTime = 1;
+    if (fFlatTop < 0) fFlatTop = 0;
+
+    fCRCoefficient = fShapingTime / (fShapingTime + 1);
+    fRCCoefficient = 1 / (fShapingTime + 1);
+    fDecayFactor = fDecayTime > 0 ? TMath::Exp(-1 / fDecayTime) : 1;
+
+    if (fFilterType != "crrc" && fFilterType != "poleZero" && fFilterType != "trapezoidal") {
+        RESTWarning << "TRestRawSignalRecursiveFilterProcess. Filter type : " << fFilterType
+                    << " is not defined!!" << RESTendl;
+    }
+    if (fFilterType == "poleZero" && fDecayTime <= 0) {
+        RESTWarning << "TRestRawSignalRecursiveFilterProcess. The poleZero filter requires a decayTime!"
+                    << RESTendl;
+    }
+
+    // The response to a unit step, or unit exponential pulse, defines the normalization
+    Int_t nSamples = (Int_t)(20 * fShapingTime * (fOrder + 1)) + 2 * fRiseTime + fFlatTop + 16;
+    if (fDecayTime > 0) nSamples = TMath::Max(nSamples, (Int_t)(10 * fDecayTime));
+    nSamples = TMath::Min(nSamples, 1 << 16);
+
+    fInput.resize(nSamples);
+    for (int n = 0; n < nSamples; n++) fInput[n] = TMath::Power(fDecayFactor, n);
+
+    fNormalization = 1;
+    ApplyFilter(nSamples, 1);
+
+    Double_t max = 0;
+    for (int n = 0; n < nSamples; n++)
+        if (TMath::Abs(fOutput[n]) > max) max = TMath::Abs(fOutput[n]);
+    if (max > 0) fNormalization = 1 / max;
+
+    RESTDebug << "TRestRawSignalRecursiveFilterProcess. Normalization : " << fNormalization << RESTendl;
+}
+
+///////////////////////////////////////////////
+/// \brief It applies the filter to the samples in fInput, leaving the result
+/// at fOutput. Both contain *nSamples* rows of *nSignals* consecutive values.
+///
+/// The filter state is kept per signal, so that the inner loops over the
+/// signals are independent and can be vectorized.
+///
+void TRestRawSignalRecursiveFilterProcess::ApplyFilter(Int_t nSamples, Int_t nSignals) {
+    fOutput.resize(fInput.size());
+    fState1.assign(nSignals, 0);
+    fState2.assign(nSignals, 0);
+
+    const Float_t* in = fInput.data();
+    Float_t* out = fOutput.data();
+    Float_t* s1 = fState1.data();
+    Float_t* s2 = fState2.data();
+
+    if (fFilterType == "crrc") {
+        const Float_t a = fCRCoefficient;
+        const Float_t b = fRCCoefficient;
+
+        // The CR differentiator, s1 keeps the previous input and s2 the previous output
+        for (int n = 0; n < nSamples; n++) {
+            const Float_t* x = in + (size_t)n * nSignals;
+            Float_t* y = out + (size_t)n * nSignals;
+            for (int c = 0; c < nSignals; c++) {
+                y[c] = a * (s2[c] + x[c] - s1[c]);
+                s1[c] = x[c];
+                s2[c] = y[c];
+            }
+        }
+
+        // The RC integrators, applied in place
+        for (int stage = 0; stage < fOrder; stage++) {
+            fState1.assign(nSignals, 0);
+            for (int n = 0; n < nSamples; n++) {
+                Float_t* y = out + (size_t)n * nSignals;
+                for (int c = 0; c < nSignals; c++) {
+                    s1[c] += b * (y[c] - s1[c]);
+                    y[c] = s1[c];
+                }
+            }
+        }
+    } else if (fFilterType == "poleZero") {
+        const Float_t k = fDecayFactor;
+
+        for (int n = 0; n < nSamples; n++) {
+            const Float_t* x = in + (size_t)n * nSignals;
+            Float_t* y = out + (size_t)n * nSignals;
+            for (int c = 0; c < nSignals; c++) {
+                y[c] = s2[c] + x[c] - k * s1[c];
+                s1[c] = x[c];
+                s2[c] = y[c];
+            }
+        }
+    } else if (fFilterType == "trapezoidal") {
+        const Int_t k = fRiseTime;
+        const Int_t l = fRiseTime + fFlatTop;
+        const Bool_t correctDecay = fDecayTime > 0;
+        const Float_t m = correctDecay ? 1 / (1 / fDecayFactor - 1) : 0;
+
+        // s1 accumulates the difference signal, and s2 its pole-zero corrected integral
+        for (int n = 0; n < nSamples; n++) {
+            const Float_t* x0 = in + (size_t)n * nSignals;
+            const Float_t* xk = n >= k ? in + (size_t)(n - k) * nSignals : nullptr;
+            const Float_t* xl = n >= l ? in + (size_t)(n - l) * nSignals : nullptr;
+            const Float_t* xkl = n >= k + l ? in + (size_t)(n - k - l) * nSignals : nullptr;
+            Float_t* y = out + (size_t)n * nSignals;
+            for (int c = 0; c < nSignals; c++) {
+                Float_t d = x0[c];
+                if (xk) d -= xk[c];
+                if (xl) d -= xl[c];
+                if (xkl) d += xkl[c];
+                s1[c] += d;
+                s2[c] += s1[c] + m * d;
+                y[c] = correctDecay ? s2[c] : s1[c];
+            }
+        }
+    } else {
+        for (size_t n = 0; n < (size_t)nSamples * nSignals; n++) out[n] = in[n];
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function
+///
+TRestEvent* TRestRawSignalRecursiveFilterProcess::ProcessEvent(TRestEvent* inputEvent) {
+    fInputSignalEvent = (TRestRawSignalEvent*)inputEvent;
+
+    vector<TRestRawSignal*> signals;
+    Int_t nSamples = 0;
+    for (int s = 0; s < fInputSignalEvent->GetNumberOfSignals(); s++) {
+        TRestRawSignal* sgnl = fInputSignalEvent->GetSignal(s);
+
+        if (fRangeEnabled && (sgnl->GetID() < fSignalsRange.X() || sgnl->GetID() > fSignalsRange.Y()))
+            continue;
+
+        if (fBaseLineRange.X() != -1 && fBaseLineRange.Y() != -1)
+            sgnl->CalculateBaseLine(fBaseLineRange.X(), fBaseLineRange.Y());
+
+        signals.push_back(sgnl);
+        nSamples = TMath::Max(nSamples, sgnl->GetNumberOfPoints());
+    }
+
+    const Int_t nSignals = signals.size();
+    if (nSignals == 0) {
+        for (int s = 0; s < fInputSignalEvent->GetNumberOfSignals(); s++)
+            fOutputSignalEvent->AddSignal(*fInputSignalEvent->GetSignal(s));
+        return fOutputSignalEvent;
+    }
+
+    fInput.assign((size_t)nSamples * nSignals, 0);
+    for (int c = 0; c < nSignals; c++)
+        for (int n = 0; n < signals[c]->GetNumberOfPoints(); n++)
+            fInput[(size_t)n * nSignals + c] = signals[c]->GetData(n);
+
+    ApplyFilter(nSamples, nSignals);
+
+    const Double_t scale = fGain * fNormalization;
+    // The output keeps the order of the input signals, the signals not processed are copied
+    Int_t c = 0;
+    for (int s = 0; s < fInputSignalEvent->GetNumberOfSignals(); s++) {
+        if (c == nSignals || fInputSignalEvent->GetSignal(s) != signals[c]) {
+            fOutputSignalEvent->AddSignal(*fInputSignalEvent->GetSignal(s));
+            continue;
+        }
+
+        TRestRawSignal filtered;
+        filtered.SetSignalID(signals[c]->GetSignalID());
+        filtered.SetStartBin(signals[c]->GetStartBin());
+        for (int n = 0; n < signals[c]->GetNumberOfPoints(); n++) {
+            const Double_t value = scale * fOutput[(size_t)n * nSignals + c];
+            if (signals[c]->IsFloat()) {
+                filtered.AddFloatPoint(value);
+            } else {
+                filtered.AddRoundedPoint(value);
+            }
+        }
+        fOutputSignalEvent->AddSignal(filtered);
+        c++;
+    }
+
+    if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Extreme) {
+        fOutputSignalEvent->PrintEvent();
+        GetChar();
+    }
+
+    return fOutputSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints out the process parameters stored in the metadata structure
+///
+void TRestRawSignalRecursiveFilterProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Filter type : " << fFilterType << RESTendl;
+    if (fFilterType == "crrc") {
+        RESTMetadata << "Shaping time : " << fShapingTime << " bins" << RESTendl;
+        RESTMetadata << "Order : " << fOrder << RESTendl;
+    }
+    if (fFilterType == "trapezoidal") {
+        RESTMetadata << "Rise time : " << fRiseTime << " bins" << RESTendl;
+        RESTMetadata << "Flat top : " << fFlatTop << " bins" << RESTendl;
+    }
+    if (fDecayTime > 0) RESTMetadata << "Decay time : " << fDecayTime << " bins" << RESTendl;
+    RESTMetadata << "Gain : " << fGain << RESTendl;
+    if (fBaseLineRange.X() != -1 && fBaseLineRange.Y() != -1)
+        RESTMetadata << "Baseline range : (" << fBaseLineRange.X() << ", " << fBaseLineRange.Y() << ")"
+                     << RESTendl;
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1)
+        RESTMetadata << "Signals range : (" << fSignalsRange.X() << ", " << fSignalsRange.Y() << ")"
+                     << RESTendl;
+
+    EndPrintProcess();
+}
@@ -270,9 +270,13 @@ TRestEvent* TRestRawSignalShapingProcess::ProcessEvent(TRestEvent* inputEvent) {
         }
 
         for (int i = 0; i < nBins; i++) {
-            shapingSignal.AddPoint((Short_t)out[i]);
+            if (inSignal.IsFloat())
+                shapingSignal.AddFloatPoint(out[i]);
+            else
+                shapingSignal.AddPoint((Short_t)out[i]);
         }
         shapingSignal.SetSignalID(inSignal.GetSignalID());
+        shapingSignal.SetStartBin(inSignal.GetStartBin());
 
         fOutputSignalEvent->AddSignal(shapingSignal);
     }
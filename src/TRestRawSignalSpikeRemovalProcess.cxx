@@ -0,0 +1,180 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawSignalSpikeRemovalProcess removes single point spikes, or
+/// glitches, from the signals found inside the input TRestRawSignalEvent.
+/// These spikes, produced by the electronics, bias the peak amplitude of
+/// the signals and produce fake points over threshold.
+///
+/// Each point is compared to the median of the 3 or 5 points centered at
+/// it, and it is replaced by the median only if they differ by more than
+/// `nSigmas` times the baseline fluctuation of the signal, calculated inside
+/// `baseLineRange` with the ROBUST method. The remaining points are not
+/// modified, so that, contrary to the smoothing used at
+/// TRestRawSignal::GetBaseLineCorrected, the pulse shapes are preserved. See
+/// TRestRawSignal::RemoveSpikes for details.
+///
+/// The signals are modified in place, and the input event is returned. The
+/// signals with a null baseline fluctuation are not modified.
+///
+/// The different parameters allowed in this process are:
+///
+/// * **window**: the number of points used for the median, 3 or 5. Default is 3.
+/// * **nSigmas**: the minimum deviation from the median, in baseline sigmas,
+/// for a point to be replaced. Default is 5.
+/// * **baseLineRange**: the range used to calculate the baseline fluctuation.
+/// Default is (10,90).
+/// * **signalsRange**: only the signals with ids inside this range are
+/// processed.
+///
+/// The number of points replaced in the event is registered in the
+/// `removedPoints` observable.
+///
+/// \code
+///   <addProcess type="TRestRawSignalSpikeRemovalProcess" name="spikes" value="ON" >
+///       <parameter name="window" value="5" />
+///       <parameter name="nSigmas" value="6" />
+///       <parameter name="baseLineRange" value="(20,120)" />
+///       <observable name="removedPoints" value="ON" />
+///   </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawSignalSpikeRemovalProcess
+///
+/// <hr>
+///
+#include "TRestRawSignalSpikeRemovalProcess.h"
+
+using namespace std;
+
+ClassImp(TRestRawSignalSpikeRemovalProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawSignalSpikeRemovalProcess::TRestRawSignalSpikeRemovalProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawSignalSpikeRemovalProcess::TRestRawSignalSpikeRemovalProcess(const char* configFilename) {
+    Initialize();
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawSignalSpikeRemovalProcess::~TRestRawSignalSpikeRemovalProcess() {}
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawSignalSpikeRemovalProcess::Initialize() {
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fSignalEvent = nullptr;
+}
+
+///////////////////////////////////////////////
+/// \brief Process initialization
+///
+void TRestRawSignalSpikeRemovalProcess::InitProcess() {
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1) fRangeEnabled = true;
+
+    if (fWindow != 3 && fWindow != 5) {
+        RESTWarning << "TRestRawSignalSpikeRemovalProcess. Window : " << fWindow
+                    << " is not supported. Using 3 points." << RESTendl;
+        fWindow = 3;
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function
+///
+TRestEvent* TRestRawSignalSpikeRemovalProcess::ProcessEvent(TRestEvent* inputEvent) {
+    fSignalEvent = (TRestRawSignalEvent*)inputEvent;
+
+    Int_t removedPoints = 0;
+    for (int s = 0; s < fSignalEvent->GetNumberOfSignals(); s++) {
+        TRestRawSignal* sgnl = fSignalEvent->GetSignal(s);
+
+        if (fRangeEnabled && (sgnl->GetID() < fSignalsRange.X() || sgnl->GetID() > fSignalsRange.Y()))
+            continue;
+
+        sgnl->CalculateBaseLine(fBaseLineRange.X(), fBaseLineRange.Y(), "ROBUST");
+        if (sgnl->GetBaseLineSigma() <= 0) continue;
+
+        removedPoints += sgnl->RemoveSpikes(fNSigmas * sgnl->GetBaseLineSigma(), fWindow);
+    }
+
+    SetObservableValue("removedPoints", removedPoints);
+
+    RESTDebug << "TRestRawSignalSpikeRemovalProcess. Event " << fSignalEvent->GetID() << " : "
+              << removedPoints << " points removed" << RESTendl;
+
+    return fSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints out the process parameters stored in the metadata structure
+///
+void TRestRawSignalSpikeRemovalProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Median window : " << fWindow << " points" << RESTendl;
+    RESTMetadata << "Threshold : " << fNSigmas << " sigmas" << RESTendl;
+    RESTMetadata << "Baseline range : (" << fBaseLineRange.X() << ", " << fBaseLineRange.Y() << ")"
+                 << RESTendl;
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1)
+        RESTMetadata << "Signals range : (" << fSignalsRange.X() << ", " << fSignalsRange.Y() << ")"
+                     << RESTendl;
+
+    EndPrintProcess();
+}
@@ -0,0 +1,305 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawSignalTemplateBuilderProcess builds the average pulse shape,
+/// or template, from the signals found in the TRestRawSignalEvents of the
+/// run. The templates are stored with the process metadata in the output
+/// file, so that they can be used by the processes requiring a pulse shape,
+/// as TRestRawSignalOptimalFilterProcess, from the production pass itself.
+/// It replaces the TRestRawFindResponseSignalProcess and the macro
+/// REST_Raw_ProduceResponseSignal.C.
+///
+/// The signals with amplitude inside `amplitudeRange` are aligned with
+/// sub-bin precision, normalized to unit amplitude, and accumulated. The
+/// alignment time is obtained with TRestRawSignal::GetMaxPeakTime, using the
+/// `parabolic`, `gaussian` or `sinc` option, or with
+/// TRestRawSignal::GetConstantFractionTime at `cfdFraction` if `alignment` is
+/// `cfd`. The template point *i* corresponds to the alignment time plus
+/// *i* - `preTrigger` bins, and the signal is linearly interpolated at that
+/// time. The points falling outside the signal are not used, and each point
+/// of the template is averaged over the pulses contributing to it. The
+/// resulting template is normalized to unit amplitude.
+///
+/// A template is built for each channel if `perChannel` is true, or a global
+/// template, with id -1, otherwise.
+///
+/// The sums accumulated by each thread are merged at EndProcess, see
+/// TRestRawThreadSums, so that the templates stored are built from the
+/// pulses of the whole run.
+///
+/// The different parameters allowed in this process are:
+///
+/// * **amplitudeRange**: the accepted signal amplitudes, baseline corrected.
+/// Default is (400,600).
+/// * **baseLineRange**: the range used to calculate the baseline. Default is
+/// (10,90).
+/// * **alignment**: parabolic, gaussian, sinc or cfd. Default is parabolic.
+/// * **cfdFraction**: the fraction used by the cfd alignment. Default is 0.5.
+/// * **templateLength**: the number of points of the template. Default is 512.
+/// * **preTrigger**: the points before the alignment time. Default is 128.
+/// * **perChannel**: if true a template is built for each channel. Default
+/// is false.
+/// * **maxSignals**: events with more signals are not used. Not used if
+/// negative, the default.
+///
+/// The number of signals used in each event is registered in the
+/// `templateSignals` observable.
+///
+/// \code
+///   <addProcess type="TRestRawSignalTemplateBuilderProcess" name="template" value="ON" >
+///       <parameter name="amplitudeRange" value="(300,3000)" />
+///       <parameter name="alignment" value="cfd" />
+///       <parameter name="templateLength" value="512" />
+///       <parameter name="preTrigger" value="150" />
+///       <parameter name="perChannel" value="true" />
+///   </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawSignalTemplateBuilderProcess
+///
+/// <hr>
+///
+#include "TRestRawSignalTemplateBuilderProcess.h"
+
+#include <TMath.h>
+
+#include <algorithm>
+
+#include "TRestRawThreadSums.h"
+
+using namespace std;
+
+ClassImp(TRestRawSignalTemplateBuilderProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawSignalTemplateBuilderProcess::TRestRawSignalTemplateBuilderProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawSignalTemplateBuilderProcess::TRestRawSignalTemplateBuilderProcess(const char* configFilename) {
+    Initialize();
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawSignalTemplateBuilderProcess::~TRestRawSignalTemplateBuilderProcess() {
+    TRestRawThreadSums::Unregister(this);
+}
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawSignalTemplateBuilderProcess::Initialize() {
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fSignalEvent = nullptr;
+}
+
+///////////////////////////////////////////////
+/// \brief Process initialization. The instance is registered to merge its
+/// sums at EndProcess.
+///
+void TRestRawSignalTemplateBuilderProcess::InitProcess() {
+    if (fTemplateLength < 1) fTemplateLength = 1;
+
+    fSums.clear();
+    fCounts.clear();
+    fEntries.clear();
+    fTemplates.clear();
+    fTemplateEntries.clear();
+
+    TRestRawThreadSums::Register(GetName(), this,
+                                 [this](const TRestRawThreadSums::Sums& sums) { SetTemplates(sums); });
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function
+///
+TRestEvent* TRestRawSignalTemplateBuilderProcess::ProcessEvent(TRestEvent* inputEvent) {
+    fSignalEvent = (TRestRawSignalEvent*)inputEvent;
+
+    Int_t templateSignals = 0;
+    if (fMaxSignals < 0 || fSignalEvent->GetNumberOfSignals() <= fMaxSignals) {
+        for (int s = 0; s < fSignalEvent->GetNumberOfSignals(); s++) {
+            TRestRawSignal* sgnl = fSignalEvent->GetSignal(s);
+
+            sgnl->CalculateBaseLine(fBaseLineRange.X(), fBaseLineRange.Y(), "ROBUST");
+            const Double_t amplitude = sgnl->GetMaxPeakValue();
+            if (amplitude < fAmplitudeRange.X() || amplitude > fAmplitudeRange.Y() || amplitude <= 0)
+                continue;
+
+            const Double_t time = fAlignment == "cfd" ? sgnl->GetConstantFractionTime(fCFDFraction)
+                                                      : sgnl->GetMaxPeakTime(ToUpper((string)fAlignment));
+            if (time < 0) continue;
+
+            const Int_t id = fPerChannel ? sgnl->GetID() : -1;
+            vector<Double_t>& sums = fSums[id];
+            vector<Double_t>& counts = fCounts[id];
+            sums.resize(fTemplateLength, 0);
+            counts.resize(fTemplateLength, 0);
+
+            const Int_t nPoints = sgnl->GetNumberOfPoints();
+            for (int i = 0; i < fTemplateLength; i++) {
+                const Double_t t = time + i - fPreTrigger;
+                const Int_t n = (Int_t)TMath::Floor(t);
+                if (n < 0 || n + 1 >= nPoints) continue;
+
+                const Double_t f = t - n;
+                sums[i] += ((1 - f) * sgnl->GetData(n) + f * sgnl->GetData(n + 1)) / amplitude;
+                counts[i]++;
+            }
+
+            fEntries[id]++;
+            templateSignals++;
+        }
+    }
+
+    SetObservableValue("templateSignals", templateSignals);
+
+    return fSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief Function to include required actions after all events have been
+/// processed. The sums of this instance are merged with the sums of the other
+/// threads, and the templates are built once all of them have finished.
+///
+void TRestRawSignalTemplateBuilderProcess::EndProcess() {
+    TRestRawThreadSums::Sums sums;
+    for (const auto& sum : fSums) {
+        sums["sums"][sum.first] = sum.second;
+        sums["counts"][sum.first] = fCounts[sum.first];
+        sums["entries"][sum.first] = {(Double_t)fEntries[sum.first]};
+    }
+    fSums.clear();
+    fCounts.clear();
+    fEntries.clear();
+
+    if (!TRestRawThreadSums::Merge(GetName(), this, sums)) return;
+
+    RESTInfo << "TRestRawSignalTemplateBuilderProcess. " << fTemplates.size() << " templates built"
+             << RESTendl;
+}
+
+///////////////////////////////////////////////
+/// \brief It calculates the templates, normalized to unit amplitude, from the
+/// merged sums of the pulses, their counts by point and their entries.
+///
+void TRestRawSignalTemplateBuilderProcess::SetTemplates(const TRestRawThreadSums::Sums& sums) {
+    fTemplates.clear();
+    fTemplateEntries.clear();
+    if (sums.count("sums") == 0) return;
+
+    for (const auto& entries : sums.at("entries")) fTemplateEntries[entries.first] = entries.second[0];
+
+    for (const auto& sum : sums.at("sums")) {
+        const vector<Double_t>& count = sums.at("counts").at(sum.first);
+        vector<Float_t>& pulse = fTemplates[sum.first];
+        pulse.assign(sum.second.size(), 0);
+        for (size_t i = 0; i < pulse.size(); i++)
+            if (count[i] > 0) pulse[i] = sum.second[i] / count[i];
+
+        const Float_t amplitude = *std::max_element(pulse.begin(), pulse.end());
+        if (amplitude > 0)
+            for (auto& value : pulse) value /= amplitude;
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the template of the given channel. If it was not built,
+/// the global template, or the average of the channel templates weighted by
+/// their number of pulses, is returned.
+///
+vector<Float_t> TRestRawSignalTemplateBuilderProcess::GetTemplate(Int_t channel) const {
+    if (fTemplates.count(channel)) return fTemplates.at(channel);
+    if (fTemplates.count(-1)) return fTemplates.at(-1);
+
+    vector<Float_t> average;
+    Long64_t entries = 0;
+    for (const auto& pulse : fTemplates) {
+        const Long64_t n = fTemplateEntries.count(pulse.first) ? fTemplateEntries.at(pulse.first) : 0;
+        average.resize(pulse.second.size(), 0);
+        for (size_t i = 0; i < average.size() && i < pulse.second.size(); i++)
+            average[i] += n * pulse.second[i];
+        entries += n;
+    }
+    if (entries > 0)
+        for (auto& value : average) value /= entries;
+
+    return average;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints out the process parameters stored in the metadata structure
+///
+void TRestRawSignalTemplateBuilderProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Amplitude range : (" << fAmplitudeRange.X() << ", " << fAmplitudeRange.Y() << ")"
+                 << RESTendl;
+    RESTMetadata << "Baseline range : (" << fBaseLineRange.X() << ", " << fBaseLineRange.Y() << ")"
+                 << RESTendl;
+    RESTMetadata << "Alignment : " << fAlignment << RESTendl;
+    if (fAlignment == "cfd") RESTMetadata << "CFD fraction : " << fCFDFraction << RESTendl;
+    RESTMetadata << "Template length : " << fTemplateLength << " points" << RESTendl;
+    RESTMetadata << "Pre-trigger : " << fPreTrigger << " points" << RESTendl;
+    RESTMetadata << "Per channel : " << (fPerChannel ? "true" : "false") << RESTendl;
+    if (fMaxSignals >= 0) RESTMetadata << "Maximum signals : " << fMaxSignals << RESTendl;
+
+    RESTMetadata << " " << RESTendl;
+    for (const auto& entries : fTemplateEntries)
+        RESTMetadata << "Template " << entries.first << " : " << entries.second << " pulses" << RESTendl;
+
+    EndPrintProcess();
+}
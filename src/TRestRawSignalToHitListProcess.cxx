@@ -0,0 +1,221 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawSignalToHitListProcess transforms a TRestRawSignalEvent into
+/// a TRestRawHitListEvent, where each signal is reduced to the hits found at
+/// its points over threshold. Each hit is defined by the signal ID, the time
+/// of its maximum, its amplitude, its integral and its width. The output
+/// events are about two orders of magnitude smaller than the raw signal
+/// events, and they are intended for the analysis stages that do not need the
+/// signal waveforms.
+///
+/// The baseline and the points over threshold of each signal are calculated
+/// as in TRestRawSignalAnalysisProcess, and the points over threshold are
+/// grouped into pulses with TRestRawSignal::FindPulses. Each hit is built from
+/// one or more of these pulses, with the same definition in both modes:
+///
+/// * The time is the bin of the maximum, interpolated with a parabola through
+/// the maximum and its two neighbour bins, see TRestRawSignal::GetMaxPeakTime.
+/// * The amplitude is the maximum value, baseline corrected.
+/// * The integral is the sum of the values of the points over threshold,
+/// baseline corrected.
+/// * The width is the number of bins from the first to the last point over
+/// threshold.
+///
+/// If `pulseHysteresis` is not defined, each signal with points over threshold
+/// produces one hit, built from all its pulses. If `pulseHysteresis` is
+/// defined, the pile-up pulses are separated with that hysteresis, and each of
+/// them produces one hit.
+///
+/// The times are given in bins of the original acquisition window, even if the
+/// signals have been cropped by TRestRawSignalROICropProcess.
+///
+/// The different parameters allowed in this process are:
+///
+/// * **baseLineRange**: the range used to calculate the baseline. Default is
+/// (10,90).
+/// * **pointThreshold**, **signalThreshold** and **pointsOverThreshold**: the
+/// points over threshold definition, in baseline sigmas, as in
+/// TRestRawSignalAnalysisProcess. Defaults are 3, 5 and 5.
+/// * **pulseHysteresis**: the hysteresis, in baseline sigmas, used to separate
+/// the pile-up pulses. Not used by default.
+/// * **signalsRange**: only the signals with ids inside this range are
+/// processed.
+///
+/// The number of hits in the event is registered in the `nHits` observable.
+///
+/// \code
+///   <addProcess type="TRestRawSignalToHitListProcess" name="hits" value="ON" >
+///       <parameter name="baseLineRange" value="(20,120)" />
+///       <parameter name="pointThreshold" value="3" />
+///       <parameter name="pulseHysteresis" value="4" />
+///       <observable name="nHits" value="ON" />
+///   </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawSignalToHitListProcess
+///
+/// <hr>
+///
+#include "TRestRawSignalToHitListProcess.h"
+
+#include <limits>
+
+using namespace std;
+
+ClassImp(TRestRawSignalToHitListProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawSignalToHitListProcess::TRestRawSignalToHitListProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawSignalToHitListProcess::TRestRawSignalToHitListProcess(const char* configFilename) {
+    Initialize();
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawSignalToHitListProcess::~TRestRawSignalToHitListProcess() { delete fOutputHitListEvent; }
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawSignalToHitListProcess::Initialize() {
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fInputSignalEvent = nullptr;
+    fOutputHitListEvent = new TRestRawHitListEvent();
+}
+
+///////////////////////////////////////////////
+/// \brief Process initialization
+///
+void TRestRawSignalToHitListProcess::InitProcess() {
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1) fRangeEnabled = true;
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function
+///
+TRestEvent* TRestRawSignalToHitListProcess::ProcessEvent(TRestEvent* inputEvent) {
+    fInputSignalEvent = (TRestRawSignalEvent*)inputEvent;
+
+    fOutputHitListEvent->Reserve(fInputSignalEvent->GetNumberOfSignals());
+
+    for (int s = 0; s < fInputSignalEvent->GetNumberOfSignals(); s++) {
+        TRestRawSignal* sgnl = fInputSignalEvent->GetSignal(s);
+
+        if (fRangeEnabled && (sgnl->GetID() < fSignalsRange.X() || sgnl->GetID() > fSignalsRange.Y()))
+            continue;
+
+        sgnl->CalculateBaseLine(fBaseLineRange.X(), fBaseLineRange.Y());
+        sgnl->InitializePointsOverThreshold(TVector2(fPointThreshold, fSignalThreshold),
+                                            fPointsOverThreshold);
+
+        if (sgnl->GetPointsOverThreshold().empty()) continue;
+
+        if (fPulseHysteresis > 0) {
+            sgnl->FindPulses(fPulses, fPulseHysteresis * sgnl->GetBaseLineSigma());
+        } else {
+            // Without hysteresis the pulses are just the groups of consecutive points over threshold,
+            // and they are merged into a single hit
+            sgnl->FindPulses(fPulses, numeric_limits<Double_t>::max());
+            TRestRawSignal::Pulse merged = fPulses.front();
+            for (size_t n = 1; n < fPulses.size(); n++) {
+                if (fPulses[n].amplitude > merged.amplitude) {
+                    merged.peakBin = fPulses[n].peakBin;
+                    merged.amplitude = fPulses[n].amplitude;
+                }
+                merged.end = fPulses[n].end;
+                merged.integral += fPulses[n].integral;
+            }
+            fPulses.assign(1, merged);
+        }
+
+        const Int_t startBin = sgnl->GetStartBin();
+        for (const auto& pulse : fPulses)
+            fOutputHitListEvent->AddHit(sgnl->GetID(), startBin + sgnl->GetMaxPeakTime(pulse.peakBin),
+                                        pulse.amplitude, pulse.integral, pulse.end - pulse.start);
+    }
+
+    SetObservableValue("nHits", fOutputHitListEvent->GetNumberOfHits());
+
+    if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Extreme) {
+        fOutputHitListEvent->PrintEvent();
+        GetChar();
+    }
+
+    return fOutputHitListEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints out the process parameters stored in the metadata structure
+///
+void TRestRawSignalToHitListProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Baseline range : (" << fBaseLineRange.X() << ", " << fBaseLineRange.Y() << ")"
+                 << RESTendl;
+    RESTMetadata << "Point threshold : " << fPointThreshold << " sigmas" << RESTendl;
+    RESTMetadata << "Signal threshold : " << fSignalThreshold << " sigmas" << RESTendl;
+    RESTMetadata << "Number of points over threshold : " << fPointsOverThreshold << RESTendl;
+    if (fPulseHysteresis > 0)
+        RESTMetadata << "Pulse hysteresis : " << fPulseHysteresis << " sigmas" << RESTendl;
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1)
+        RESTMetadata << "Signals range : (" << fSignalsRange.X() << ", " << fSignalsRange.Y() << ")"
+                     << RESTendl;
+
+    EndPrintProcess();
+}
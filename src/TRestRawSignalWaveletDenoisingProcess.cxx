@@ -0,0 +1,354 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// The TRestRawSignalWaveletDenoisingProcess reduces the noise of the signals
+/// found inside the input TRestRawSignalEvent using a discrete wavelet
+/// transform. The signals are decomposed into `levels` levels of detail
+/// coefficients, the coefficients compatible with the noise are suppressed,
+/// and the signals are reconstructed with the inverse transform. Contrary to a
+/// moving average, the pulses are localized in a few large coefficients, so
+/// that the noise is reduced while the pulse height and rise time are kept.
+///
+/// The CDF 5/3 biorthogonal wavelet is implemented with the lifting scheme.
+/// The transform is calculated in place, with a cost proportional to the
+/// number of samples, and it is exactly inverted. The signals of the event are
+/// arranged in a matrix where consecutive signals are contiguous in memory for
+/// a given time bin, so that all the signals are transformed at the same time
+/// and the inner loops are vectorized by the compiler. The buffers are kept by
+/// the process, and no memory is allocated for each signal once the first
+/// event has been processed.
+///
+/// The threshold of each coefficient is `nSigmas` times the baseline
+/// fluctuation of the signal, calculated inside `baseLineRange` with the ROBUST
+/// method, times the standard deviation of the coefficient for a unit white
+/// noise, which is calculated once for each number of samples. The threshold
+/// may be applied as:
+///
+/// * **soft**: the coefficients below the threshold are set to zero, and the
+/// threshold is subtracted from the others.
+/// * **hard**: the coefficients below the threshold are set to zero, and the
+/// others are not modified.
+///
+/// The different parameters allowed in this process are:
+///
+/// * **levels**: the maximum number of decomposition levels. Default is 4.
+/// * **thresholdType**: soft or hard. Default is soft.
+/// * **nSigmas**: the threshold in baseline sigmas. Default is 3.
+/// * **baseLineRange**: the range used to calculate the baseline fluctuation.
+/// Default is (10,90).
+/// * **signalsRange**: only the signals with ids inside this range are
+/// processed, the others are copied unchanged.
+///
+/// \code
+///   <addProcess type="TRestRawSignalWaveletDenoisingProcess" name="wavelet" value="ON" >
+///       <parameter name="levels" value="5" />
+///       <parameter name="thresholdType" value="hard" />
+///       <parameter name="nSigmas" value="4" />
+///       <parameter name="baseLineRange" value="(20,120)" />
+///   </addProcess>
+/// \endcode
+///
+/// <hr>
+///
+/// \warning **⚠ REST is under continous development.** This
+/// documentation
+/// is offered to you by the REST community. Your HELP is needed to keep this
+/// code
+/// up to date. Your feedback will be worth to support this software, please
+/// report
+/// any problems/suggestions you may find while using it at [The REST Framework
+/// forum](http://ezpc10.unizar.es). You are welcome to contribute fixing typos,
+/// updating
+/// information or adding/proposing new contributions. See also our
+/// <a href="https://github.com/rest-for-physics/framework/blob/master/CONTRIBUTING.md">Contribution
+/// Guide</a>.
+///
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawSignalWaveletDenoisingProcess
+///
+/// <hr>
+///
+#include "TRestRawSignalWaveletDenoisingProcess.h"
+
+#include <TMath.h>
+
+using namespace std;
+
+ClassImp(TRestRawSignalWaveletDenoisingProcess);
+
+///////////////////////////////////////////////
+/// \brief Default constructor
+///
+TRestRawSignalWaveletDenoisingProcess::TRestRawSignalWaveletDenoisingProcess() { Initialize(); }
+
+///////////////////////////////////////////////
+/// \brief Constructor loading data from a config file
+///
+TRestRawSignalWaveletDenoisingProcess::TRestRawSignalWaveletDenoisingProcess(const char* configFilename) {
+    Initialize();
+    LoadConfigFromFile(configFilename);
+}
+
+///////////////////////////////////////////////
+/// \brief Default destructor
+///
+TRestRawSignalWaveletDenoisingProcess::~TRestRawSignalWaveletDenoisingProcess() { delete fOutputSignalEvent; }
+
+///////////////////////////////////////////////
+/// \brief Function to initialize input/output event members and define the
+/// section name
+///
+void TRestRawSignalWaveletDenoisingProcess::Initialize() {
+    SetSectionName(this->ClassName());
+    SetLibraryVersion(LIBRARY_VERSION);
+
+    fInputSignalEvent = nullptr;
+    fOutputSignalEvent = new TRestRawSignalEvent();
+}
+
+///////////////////////////////////////////////
+/// \brief Process initialization
+///
+void TRestRawSignalWaveletDenoisingProcess::InitProcess() {
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1) fRangeEnabled = true;
+
+    if (fLevels < 1) fLevels = 1;
+
+    if (fThresholdType != "soft" && fThresholdType != "hard") {
+        RESTWarning << "TRestRawSignalWaveletDenoisingProcess. Threshold type : " << fThresholdType
+                    << " is not defined!! Using soft." << RESTendl;
+        fThresholdType = "soft";
+    }
+
+    fNoiseGain.clear();
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the number of levels of the transform of *nSamples*
+/// samples, limited by fLevels and by the number of samples available.
+///
+Int_t TRestRawSignalWaveletDenoisingProcess::GetNumberOfLevels(Int_t nSamples) const {
+    Int_t levels = 0;
+    while (levels < fLevels && (nSamples + (1 << levels) - 1) >> levels >= 2) levels++;
+    return levels;
+}
+
+///////////////////////////////////////////////
+/// \brief It calculates the forward, or inverse, transform of the samples in
+/// fCoefficients, in place. It contains *nSamples* rows of *nSignals*
+/// consecutive values.
+///
+/// At each level the odd samples are predicted from their even neighbours,
+/// becoming the detail coefficients, and the even samples are updated with
+/// the details, becoming the approximation for the next level. The samples of
+/// the level *j* are separated by 2^j rows, so that after the transform the
+/// rows multiple of 2^levels contain the approximation and the rest contain
+/// the details. The signal is symmetrically extended at the edges.
+///
+void TRestRawSignalWaveletDenoisingProcess::Transform(Int_t nSamples, Int_t nSignals, Bool_t inverse) {
+    const Int_t levels = GetNumberOfLevels(nSamples);
+
+    for (int l = 0; l < levels; l++) {
+        const Int_t level = inverse ? levels - 1 - l : l;
+        const Int_t nPoints = (nSamples + (1 << level) - 1) >> level;
+        const size_t step = ((size_t)1 << level) * nSignals;
+        Float_t* row0 = fCoefficients.data();
+
+        // Predict step, it subtracts from the odd points the average of their neighbours
+        auto predict = [&](Float_t sign) {
+            for (int t = 1; t < nPoints; t += 2) {
+                Float_t* x = row0 + t * step;
+                const Float_t* left = x - step;
+                const Float_t* right = t + 1 < nPoints ? x + step : left;
+                for (int c = 0; c < nSignals; c++) x[c] -= sign * 0.5f * (left[c] + right[c]);
+            }
+        };
+
+        // Update step, it adds to the even points a quarter of their neighbour details
+        auto update = [&](Float_t sign) {
+            for (int t = 0; t < nPoints; t += 2) {
+                Float_t* x = row0 + t * step;
+                const Float_t* right = t + 1 < nPoints ? x + step : x - step;
+                const Float_t* left = t > 0 ? x - step : right;
+                for (int c = 0; c < nSignals; c++) x[c] += sign * 0.25f * (left[c] + right[c]);
+            }
+        };
+
+        if (inverse) {
+            update(-1);
+            predict(-1);
+        } else {
+            predict(1);
+            update(1);
+        }
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief It calculates the standard deviation of each wavelet coefficient
+/// for a unit white noise, which is used to scale the thresholds. It is the
+/// norm of the corresponding row of the transform matrix, which is obtained
+/// transforming each unit impulse.
+///
+void TRestRawSignalWaveletDenoisingProcess::CalculateNoiseGain(Int_t nSamples) {
+    fNumberOfLevels = GetNumberOfLevels(nSamples);
+
+    vector<Double_t> variance(nSamples, 0);
+    for (int k = 0; k < nSamples; k++) {
+        fCoefficients.assign(nSamples, 0);
+        fCoefficients[k] = 1;
+        Transform(nSamples, 1, false);
+        for (int n = 0; n < nSamples; n++) variance[n] += fCoefficients[n] * fCoefficients[n];
+    }
+
+    fNoiseGain.resize(nSamples);
+    for (int n = 0; n < nSamples; n++) fNoiseGain[n] = TMath::Sqrt(variance[n]);
+
+    RESTDebug << "TRestRawSignalWaveletDenoisingProcess. Noise gain calculated for " << nSamples
+              << " samples and " << fNumberOfLevels << " levels" << RESTendl;
+}
+
+///////////////////////////////////////////////
+/// \brief It applies the thresholds to the detail coefficients. The
+/// approximation coefficients, at the rows multiple of 2^levels, are not
+/// modified.
+///
+void TRestRawSignalWaveletDenoisingProcess::ApplyThresholds(Int_t nSamples, Int_t nSignals) {
+    const Int_t approximation = (1 << fNumberOfLevels) - 1;
+    const Bool_t soft = fThresholdType == "soft";
+    const Float_t* thresholds = fThresholds.data();
+
+    for (int n = 0; n < nSamples; n++) {
+        if ((n & approximation) == 0) continue;
+
+        Float_t* x = fCoefficients.data() + (size_t)n * nSignals;
+        const Float_t gain = fNoiseGain[n];
+        for (int c = 0; c < nSignals; c++) {
+            const Float_t threshold = gain * thresholds[c];
+            const Float_t excess = std::abs(x[c]) - threshold;
+            const Float_t kept = soft ? std::copysign(excess, x[c]) : x[c];
+            x[c] = excess > 0 ? kept : 0;
+        }
+    }
+}
+
+///////////////////////////////////////////////
+/// \brief The main processing event function
+///
+TRestEvent* TRestRawSignalWaveletDenoisingProcess::ProcessEvent(TRestEvent* inputEvent) {
+    fInputSignalEvent = (TRestRawSignalEvent*)inputEvent;
+
+    vector<TRestRawSignal*> signals;
+    Int_t nSamples = 0;
+    for (int s = 0; s < fInputSignalEvent->GetNumberOfSignals(); s++) {
+        TRestRawSignal* sgnl = fInputSignalEvent->GetSignal(s);
+
+        if (sgnl->GetNumberOfPoints() == 0 ||
+            (fRangeEnabled && (sgnl->GetID() < fSignalsRange.X() || sgnl->GetID() > fSignalsRange.Y())))
+            continue;
+
+        sgnl->CalculateBaseLine(fBaseLineRange.X(), fBaseLineRange.Y(), "ROBUST");
+
+        signals.push_back(sgnl);
+        nSamples = TMath::Max(nSamples, sgnl->GetNumberOfPoints());
+    }
+
+    const Int_t nSignals = signals.size();
+    if (nSignals == 0) {
+        for (int s = 0; s < fInputSignalEvent->GetNumberOfSignals(); s++)
+            fOutputSignalEvent->AddSignal(*fInputSignalEvent->GetSignal(s));
+        return fOutputSignalEvent;
+    }
+
+    if ((Int_t)fNoiseGain.size() != nSamples) CalculateNoiseGain(nSamples);
+
+    // Shorter signals are extended with their last point
+    fCoefficients.resize((size_t)nSamples * nSignals);
+    fThresholds.resize(nSignals);
+    for (int c = 0; c < nSignals; c++) {
+        const Int_t nPoints = signals[c]->GetNumberOfPoints();
+        for (int n = 0; n < nSamples; n++)
+            fCoefficients[(size_t)n * nSignals + c] = signals[c]->GetRawData(TMath::Min(n, nPoints - 1));
+        fThresholds[c] = fNSigmas * signals[c]->GetBaseLineSigma();
+    }
+
+    Transform(nSamples, nSignals, false);
+    ApplyThresholds(nSamples, nSignals);
+    Transform(nSamples, nSignals, true);
+
+    // The output keeps the order of the input signals, the signals not processed are copied
+    Int_t c = 0;
+    for (int s = 0; s < fInputSignalEvent->GetNumberOfSignals(); s++) {
+        if (c == nSignals || fInputSignalEvent->GetSignal(s) != signals[c]) {
+            fOutputSignalEvent->AddSignal(*fInputSignalEvent->GetSignal(s));
+            continue;
+        }
+
+        TRestRawSignal denoised;
+        denoised.SetSignalID(signals[c]->GetSignalID());
+        denoised.SetStartBin(signals[c]->GetStartBin());
+        for (int n = 0; n < signals[c]->GetNumberOfPoints(); n++) {
+            const Double_t value = fCoefficients[(size_t)n * nSignals + c];
+            if (signals[c]->IsFloat()) {
+                denoised.AddFloatPoint(value);
+            } else {
+                denoised.AddRoundedPoint(value);
+            }
+        }
+        fOutputSignalEvent->AddSignal(denoised);
+        c++;
+    }
+
+    if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Extreme) {
+        fOutputSignalEvent->PrintEvent();
+        GetChar();
+    }
+
+    return fOutputSignalEvent;
+}
+
+///////////////////////////////////////////////
+/// \brief It prints out the process parameters stored in the metadata structure
+///
+void TRestRawSignalWaveletDenoisingProcess::PrintMetadata() {
+    BeginPrintProcess();
+
+    RESTMetadata << "Levels : " << fLevels << RESTendl;
+    RESTMetadata << "Threshold type : " << fThresholdType << RESTendl;
+    RESTMetadata << "Threshold : " << fNSigmas << " sigmas" << RESTendl;
+    RESTMetadata << "Baseline range : (" << fBaseLineRange.X() << ", " << fBaseLineRange.Y() << ")"
+                 << RESTendl;
+    if (fSignalsRange.X() != -1 && fSignalsRange.Y() != -1)
+        RESTMetadata << "Signals range : (" << fSignalsRange.X() << ", " << fSignalsRange.Y() << ")"
+                     << RESTendl;
+
+    EndPrintProcess();
+}
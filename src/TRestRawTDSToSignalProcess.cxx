@@ -45,6 +45,9 @@
 /// 2022-05: First implementation of TRestRawTDSToSignalProcess
 /// JuanAn Garcia
 ///
+/// 2026-10: Channel data frames and events are accounted in the common decoding
+/// statistics
+///
 /// \class TRestRawTDSToSignalProcess
 /// \author: JuanAn Garcia juanangp@unizar.es
 ///
@@ -82,6 +85,7 @@ void TRestRawTDSToSignalProcess::InitProcess() {
     ANABlockHead blockhead;
     if (fread(&blockhead, sizeof(blockhead), 1, fInputBinFile) != 1) return;
     totalBytesReaded = sizeof(blockhead);
+    ResetStatistics();
     nSamples = blockhead.NEvents;
     nChannels = blockhead.NHits / blockhead.NEvents;
     fRate = blockhead.SRate;
@@ -133,6 +137,7 @@ TRestEvent* TRestRawTDSToSignalProcess::ProcessEvent(TRestEvent* evInput) {
         // Read data frame and store in buffer
         if (fread((char*)&buffer[0], pulseDepth, 1, fInputBinFile) != 1) return nullptr;
         totalBytesReaded += pulseDepth;
+        AddFrame();
         for (int j = 0; j < pulseDepth; j++) {
             Short_t data = buffer[j];
             if (negPolarity[i]) data *= -1;  // Inversion in case pulses are negative
@@ -145,5 +150,6 @@ TRestEvent* TRestRawTDSToSignalProcess::ProcessEvent(TRestEvent* evInput) {
     fRunInfo->SetEndTimeStamp(tNow + static_cast<double>(eventhead.clockTicksLT) * 1E-6);
     nEvents++;
 
+    AddEvent();
     return fSignalEvent;
 }
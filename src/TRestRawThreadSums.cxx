@@ -0,0 +1,136 @@
+/*************************************************************************
+ * This file is part of the REST software framework.                     *
+ *                                                                       *
+ * Copyright (C) 2016 GIFNA/TREX (University of Zaragoza)                *
+ * For more information see http://gifna.unizar.es/trex                  *
+ *                                                                       *
+ * REST is free software: you can redistribute it and/or modify          *
+ * it under the terms of the GNU General Public License as published by  *
+ * the Free Software Foundation, either version 3 of the License, or     *
+ * (at your option) any later version.                                   *
+ *                                                                       *
+ * REST is distributed in the hope that it will be useful,               *
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the          *
+ * GNU General Public License for more details.                          *
+ *                                                                       *
+ * You should have a copy of the GNU General Public License along with   *
+ * REST in $REST_PATH/LICENSE.                                           *
+ * If not, see http://www.gnu.org/licenses/.                             *
+ * For the list of contributors see $REST_PATH/CREDITS.                  *
+ *************************************************************************/
+
+//////////////////////////////////////////////////////////////////////////
+/// TRestRawThreadSums merges the sums accumulated during a run by the
+/// instances of a process, one for each thread, so that every instance ends
+/// up with the sums of the whole run. It is used by the processes storing
+/// run-level results with their metadata, as the noise spectra of
+/// TRestRawSignalOptimalFilterProcess or the templates of
+/// TRestRawSignalTemplateBuilderProcess, which would otherwise depend on the
+/// thread whose instance is written to the output file.
+///
+/// The instances with the same process name form a group, and the same rules
+/// apply to all of them:
+///
+/// * Each instance calls Register at InitProcess. A new run starts, and the
+/// merged sums of the group are cleared, when no instance of the group is
+/// running, or when the instance was already registered in the current run,
+/// which means that the previous run was aborted before all the instances
+/// reached their EndProcess.
+/// * Each instance calls Merge at EndProcess with its own sums, which are
+/// added to the merged sums. Once the last running instance of the group has
+/// merged, the merged sums are placed in every instance of the group through
+/// the receiver given at Register, and Merge returns true.
+/// * Each instance calls Unregister when it is deleted.
+///
+/// The sums are given by channel and by name of the quantity summed, and the
+/// vectors are added element by element.
+///
+///--------------------------------------------------------------------------
+///
+/// RESTsoft - Software for Rare Event Searches with TPCs
+///
+/// History of developments:
+///
+/// 2026-October: First implementation
+///
+/// \class      TRestRawThreadSums
+///
+/// <hr>
+///
+#include "TRestRawThreadSums.h"
+
+#include <algorithm>
+#include <mutex>
+#include <set>
+
+using namespace std;
+
+namespace {
+/// The instances of a process with the same name, and their merged sums
+struct Group {
+    map<const void*, TRestRawThreadSums::Receiver> instances;
+    set<const void*> registered;
+    set<const void*> running;
+    TRestRawThreadSums::Sums sums;
+};
+
+std::mutex gGroupsMutex;
+std::map<string, Group> gGroups;
+}  // namespace
+
+///////////////////////////////////////////////
+/// \brief It registers the instance at the start of the run, with the function
+/// that will receive the merged sums of the group.
+///
+void TRestRawThreadSums::Register(const string& name, const void* instance, const Receiver& receiver) {
+    std::lock_guard<std::mutex> lock(gGroupsMutex);
+    Group& group = gGroups[name];
+
+    if (group.running.empty() || group.registered.count(instance)) {
+        group.registered.clear();
+        group.running.clear();
+        group.sums.clear();
+    }
+
+    group.instances[instance] = receiver;
+    group.registered.insert(instance);
+    group.running.insert(instance);
+}
+
+///////////////////////////////////////////////
+/// \brief It adds the sums of the instance to the merged sums of its group.
+///
+/// \return true if the instance was the last one running, and the merged sums
+/// have been placed in all the instances of the group
+///
+Bool_t TRestRawThreadSums::Merge(const string& name, const void* instance, const Sums& sums) {
+    std::lock_guard<std::mutex> lock(gGroupsMutex);
+    Group& group = gGroups[name];
+    if (group.running.erase(instance) == 0) return false;
+
+    for (const auto& quantity : sums) {
+        for (const auto& channel : quantity.second) {
+            vector<Double_t>& merged = group.sums[quantity.first][channel.first];
+            merged.resize(std::max(merged.size(), channel.second.size()), 0);
+            for (size_t i = 0; i < channel.second.size(); i++) merged[i] += channel.second[i];
+        }
+    }
+
+    if (!group.running.empty()) return false;
+
+    for (const auto& receiver : group.instances) receiver.second(group.sums);
+    return true;
+}
+
+///////////////////////////////////////////////
+/// \brief It removes the instance from any group.
+///
+void TRestRawThreadSums::Unregister(const void* instance) {
+    std::lock_guard<std::mutex> lock(gGroupsMutex);
+    for (auto& group : gGroups) {
+        group.second.instances.erase(instance);
+        group.second.registered.erase(instance);
+        group.second.running.erase(instance);
+    }
+}
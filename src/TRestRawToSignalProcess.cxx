@@ -26,6 +26,36 @@
 ///
 /// DOCUMENTATION TO BE WRITTEN (main description, methods, data members)
 ///
+/// ### Header pre-filter
+///
+/// Decoders may reject events using only the information found in the data
+/// headers, before any TRestRawSignal is built, and skip the event payload
+/// directly. The following parameters are common to all decoders, although
+/// each decoder only evaluates those that are available in its data format.
+///
+/// * **eventSizeRange**: accepted range of the event size in bytes.
+/// * **hitsRange**: accepted range of the number of hit channels.
+/// * **acceptedEventTypes**: comma separated list of accepted event/trigger
+/// types.
+///
+/// A negative range limit disables the corresponding check.
+///
+/// ### Decoding statistics
+///
+/// All decoders share a set of statistics: bytes read, frames, bad frames,
+/// events, empty events, events rejected by the pre-filter and bytes skipped
+/// while resynchronizing, together with the average event rate and data
+/// throughput. They are stored with the process metadata and summarized at
+/// EndProcess. A progress line is printed every `progressInterval` seconds
+/// (10 by default, disabled if not positive) at info verbose level.
+///
+/// \code
+/// <TRestRawMultiCoBoAsAdToSignalProcess name="daq" electronics="AGET" >
+///     <parameter name="hitsRange" value="(1,200)" />
+///     <parameter name="eventSizeRange" value="(-1,500000)" />
+/// </TRestRawMultiCoBoAsAdToSignalProcess>
+/// \endcode
+///
 /// <hr>
 ///
 /// \warning **⚠ REST is under continous development.** This
@@ -51,6 +81,9 @@
 /// 2015-June: First implementation of abstract class for binary format reading
 ///             Juanan Garcia
 ///
+/// 2026-October: Added header pre-filter parameters, SeekToPattern frame
+///               resynchronization helper and common decoding statistics
+///
 /// \class      TRestRawToSignalProcess
 /// \author     Juanan Garcia
 ///
@@ -60,8 +93,17 @@
 
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <chrono>
+
 using namespace std;
 
+namespace {
+Double_t GetClockSeconds() {
+    return chrono::duration<Double_t>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+}  // namespace
+
 #include "TTimeStamp.h"
 
 ClassImp(TRestRawToSignalProcess);
@@ -109,6 +151,14 @@ void TRestRawToSignalProcess::InitFromConfigFile() {
     fElectronicsType = GetParameter("electronics");
     fShowSamples = StringToInteger(GetParameter("showSamples", "10"));
     fMinPoints = StringToInteger(GetParameter("minPoints", "512"));
+    fProgressInterval = StringToDouble(GetParameter("progressInterval", "10"));
+
+    fEventSizeRange = StringTo2DVector(GetParameter("eventSizeRange", "(-1,-1)"));
+    fHitsRange = StringTo2DVector(GetParameter("hitsRange", "(-1,-1)"));
+    fAcceptedEventTypes.clear();
+    string eventTypes = GetParameter("acceptedEventTypes", "");
+    if (!eventTypes.empty())
+        for (const auto& type : StringToElements(eventTypes, ",")) fAcceptedEventTypes.push_back((Int_t)type);
 
     PrintMetadata();
 
@@ -195,6 +245,112 @@ Bool_t TRestRawToSignalProcess::ResetEntry() {
     return true;
 }
 
+///////////////////////////////////////////////
+/// \brief It closes the file being read, fInputBinFile, and removes it from
+/// the input files. Decoders should use it instead of closing fInputBinFile
+/// themselves, so that it is not closed again by CloseInputFiles.
+///
+void TRestRawToSignalProcess::CloseInputBinFile() {
+    if (fInputBinFile == nullptr) return;
+    std::replace(fInputFiles.begin(), fInputFiles.end(), fInputBinFile, (FILE*)nullptr);
+    fclose(fInputBinFile);
+    fInputBinFile = nullptr;
+}
+
+///////////////////////////////////////////////
+/// \brief It closes the input files that are still open
+///
+void TRestRawToSignalProcess::CloseInputFiles() {
+    // Without fgKeepFileOpen the file being read is opened again by GoToNextFile
+    if (!fgKeepFileOpen) CloseInputBinFile();
+    for (auto& f : fInputFiles) {
+        if (f != nullptr) fclose(f);
+        f = nullptr;
+    }
+    fInputBinFile = nullptr;
+}
+
+///////////////////////////////////////////////
+/// \brief It resets the decoding statistics. Decoders should call it at
+/// InitProcess.
+///
+void TRestRawToSignalProcess::ResetStatistics() {
+    fNFrames = 0;
+    fNBadFrames = 0;
+    fNEvents = 0;
+    fNEmptyEvents = 0;
+    fPreFilterRejected = 0;
+    fSkippedBytes = 0;
+    fDecodingTime = 0;
+    fEventRate = 0;
+    fDataRate = 0;
+    fClockStart = -1;
+    fLastProgress = -1;
+}
+
+///////////////////////////////////////////////
+/// \brief It must be called each time an event is returned by the decoder.
+///
+/// The clock is only checked every 64 events, and a single progress line is
+/// printed when `progressInterval` seconds have passed since the last one.
+///
+void TRestRawToSignalProcess::AddEvent() {
+    fNEvents++;
+
+    if (fClockStart < 0) {
+        fClockStart = GetClockSeconds();
+        fLastProgress = fClockStart;
+        return;
+    }
+
+    if (fProgressInterval <= 0 || fNEvents % 64 != 0) return;
+    if (GetVerboseLevel() < TRestStringOutput::REST_Verbose_Level::REST_Info) return;
+
+    Double_t now = GetClockSeconds();
+    if (now - fLastProgress < fProgressInterval) return;
+    fLastProgress = now;
+
+    UpdateRates();
+    RESTInfo << this->GetName() << " : " << fNEvents << " events, " << totalBytesReaded / 1.e6 << " MB read ("
+             << fEventRate << " events/s, " << fDataRate << " MB/s)" << RESTendl;
+}
+
+///////////////////////////////////////////////
+/// \brief It updates the decoding time, event rate and data throughput
+///
+void TRestRawToSignalProcess::UpdateRates() {
+    if (fClockStart < 0) return;
+
+    fDecodingTime = GetClockSeconds() - fClockStart;
+    if (fDecodingTime <= 0) return;
+
+    fEventRate = fNEvents / fDecodingTime;
+    fDataRate = totalBytesReaded / 1.e6 / fDecodingTime;
+}
+
+///////////////////////////////////////////////
+/// \brief It updates the statistics, that will be stored together with the
+/// process metadata, and prints a summary.
+///
+void TRestRawToSignalProcess::EndProcess() {
+    UpdateRates();
+
+    RESTInfo << this->GetName() << " : " << fNEvents << " events and " << fNFrames << " frames decoded from "
+             << totalBytesReaded / 1.e6 << " MB in " << fDecodingTime << " s (" << fEventRate
+             << " events/s, " << fDataRate << " MB/s)" << RESTendl;
+    if (fPreFilterRejected > 0)
+        RESTInfo << this->GetName() << " : " << fPreFilterRejected
+                 << " events rejected by the header pre-filter" << RESTendl;
+    if (fNEmptyEvents > 0)
+        RESTWarning << this->GetName() << " : " << fNEmptyEvents << " events without signals skipped"
+                    << RESTendl;
+    if (fNBadFrames > 0)
+        RESTWarning << this->GetName() << " : " << fNBadFrames << " corrupted frames found" << RESTendl;
+    if (fSkippedBytes > 0)
+        RESTWarning << this->GetName() << " : " << fSkippedBytes
+                    << " bytes skipped while resynchronizing to valid frames" << RESTendl;
+}
+
 void TRestRawToSignalProcess::PrintMetadata() {
     BeginPrintProcess();
 
@@ -204,6 +360,24 @@ void TRestRawToSignalProcess::PrintMetadata() {
     RESTMetadata << "Electronics type : " << fElectronicsType << RESTendl;
     RESTMetadata << "Minimum number of points : " << fMinPoints << RESTendl;
     RESTMetadata << "All raw files open at beginning : " << fgKeepFileOpen << RESTendl;
+    if (fEventSizeRange.X() >= 0 || fEventSizeRange.Y() >= 0)
+        RESTMetadata << "Accepted event size range : (" << fEventSizeRange.X() << ", " << fEventSizeRange.Y()
+                     << ") bytes" << RESTendl;
+    if (fHitsRange.X() >= 0 || fHitsRange.Y() >= 0)
+        RESTMetadata << "Accepted hits range : (" << fHitsRange.X() << ", " << fHitsRange.Y() << ")"
+                     << RESTendl;
+    for (const auto& type : fAcceptedEventTypes) RESTMetadata << "Accepted event type : " << type << RESTendl;
+    if (fNEvents > 0) {
+        RESTMetadata << " ------------------------------------ " << RESTendl;
+        RESTMetadata << "Bytes read : " << totalBytesReaded << RESTendl;
+        RESTMetadata << "Frames decoded : " << fNFrames << " (bad frames : " << fNBadFrames << ")"
+                     << RESTendl;
+        RESTMetadata << "Events decoded : " << fNEvents << " (empty : " << fNEmptyEvents
+                     << ", rejected : " << fPreFilterRejected << ")" << RESTendl;
+        RESTMetadata << "Skipped bytes : " << fSkippedBytes << RESTendl;
+        RESTMetadata << "Event rate : " << fEventRate << " events/s" << RESTendl;
+        RESTMetadata << "Data rate : " << fDataRate << " MB/s" << RESTendl;
+    }
     RESTMetadata << " ==================================== " << RESTendl;
 
     RESTMetadata << " " << RESTendl;
@@ -211,13 +385,69 @@ void TRestRawToSignalProcess::PrintMetadata() {
     EndPrintProcess();
 }
 
+///////////////////////////////////////////////
+/// \brief It searches forward in the file `f` for the next occurrence of a
+/// byte `pattern` that is accepted by the `validate` function, and positions
+/// the file at the beginning of the match.
+///
+/// The file is read in large blocks and the candidate positions are located
+/// using memchr, that is vectorized in most C libraries, so that resynchronizing
+/// after a corrupted frame does not require one fread call per word. The
+/// candidate is given to `validate` only once `matchSize` bytes are available.
+///
+/// It returns the number of bytes skipped before the match, or -1 if the end
+/// of file is reached, or more than `maxSkip` bytes (when positive) would need
+/// to be skipped.
+///
+Long64_t TRestRawToSignalProcess::SeekToPattern(FILE* f, const std::vector<UChar_t>& pattern,
+                                                size_t matchSize,
+                                                const std::function<bool(const UChar_t*)>& validate,
+                                                Long64_t maxSkip) {
+    if (f == nullptr || pattern.empty()) return -1;
+    if (matchSize < pattern.size()) matchSize = pattern.size();
+
+    const size_t blockSize = 1 << 16;
+    std::vector<UChar_t> buffer(blockSize + matchSize);
+
+    Long64_t skipped = 0;
+    size_t kept = 0;
+    while (true) {
+        size_t nRead = fread(buffer.data() + kept, 1, blockSize, f);
+        size_t available = kept + nRead;
+        if (available < matchSize) return -1;
+
+        // candidate positions with matchSize bytes available
+        size_t limit = available - matchSize + 1;
+        if (maxSkip >= 0 && (Long64_t)limit > maxSkip - skipped + 1) limit = maxSkip - skipped + 1;
+
+        const UChar_t* begin = buffer.data();
+        const UChar_t* pos = begin;
+        while ((pos = (const UChar_t*)memchr(pos, pattern[0], limit - (pos - begin))) != nullptr) {
+            if (memcmp(pos, pattern.data(), pattern.size()) == 0 && (!validate || validate(pos))) {
+                // rewind the file to the beginning of the match
+                if (fseek(f, -(long)(available - (pos - begin)), SEEK_CUR) != 0) return -1;
+                return skipped + (pos - begin);
+            }
+            pos++;
+        }
+
+        skipped += limit;
+        if (nRead == 0 || (maxSkip >= 0 && skipped > maxSkip)) return -1;
+
+        kept = available - limit;
+        memmove(buffer.data(), buffer.data() + limit, kept);
+    }
+
+    return -1;
+}
+
 Bool_t TRestRawToSignalProcess::GoToNextFile() {
     iCurFile++;
     if (iCurFile < nFiles) {
         if (fgKeepFileOpen) {
             fInputBinFile = fInputFiles[iCurFile];
         } else {
-            fclose(fInputBinFile);
+            CloseInputBinFile();
             fInputBinFile = fopen(fInputFileNames[iCurFile].c_str(), "rb");
         }
         RESTInfo << "GoToNextFile(): Going to the next raw input file number " << iCurFile << " over "
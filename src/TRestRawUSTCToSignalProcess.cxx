@@ -51,6 +51,10 @@
 /// 201X-X:    First implementation
 ///            SJTU PandaX-III
 ///
+/// 2026-October: FixToNextFrame uses the buffered SeekToPattern search. Skipped
+///               bytes and error frames are accounted in the common decoding
+///               statistics.
+///
 /// \class      TRestRawUSTCToSignalProcess
 /// \author     SJTU PandaX-III
 ///
@@ -87,8 +91,8 @@ void TRestRawUSTCToSignalProcess::Initialize() {
 void TRestRawUSTCToSignalProcess::InitProcess() {
     fEventBuffer.clear();
     errorevents.clear();
-    unknownerrors = 0;
     fLastBufferedId = 0;
+    ResetStatistics();
 
 #ifndef Incoherent_Event_Generation
     nBufferedEvent = StringToInteger(GetParameter("BufferNumber", "2"));
@@ -164,9 +168,7 @@ TRestEvent* TRestRawUSTCToSignalProcess::ProcessEvent(TRestEvent* inputEvent) {
         if (frame->evId == fCurrentEvent && frame->eventTime == evtTime) {
             sgnl.Initialize();
             sgnl.SetSignalID(frame->signalId);
-            for (int j = 0; j < 512; j++) {
-                sgnl.AddPoint((Short_t)frame->dataPoint[j]);
-            }
+            sgnl.AddPoints(frame->dataPoint, 512);
             fSignalEvent->AddSignal(sgnl);
 
             RESTDebug << "AsAdId, AgetId, chnId, max value: " << frame->boardId << ", " << frame->chipId
@@ -178,8 +180,10 @@ TRestEvent* TRestRawUSTCToSignalProcess::ProcessEvent(TRestEvent* inputEvent) {
             RESTWarning << "Time (supposed, received) : " << evtTime << ", " << frame->eventTime << RESTendl;
             RESTWarning << RESTendl;
             fSignalEvent->SetOK(false);
+            AddBadFrame();
             fCurrentEvent++;
             ClearBuffer();
+            AddEvent();
             return fSignalEvent;
         }
     }
@@ -198,17 +202,17 @@ TRestEvent* TRestRawUSTCToSignalProcess::ProcessEvent(TRestEvent* inputEvent) {
     // if( fSignalEvent->GetNumberOfSignals( ) == 0 ) return nullptr;
     fCurrentEvent++;
 
+    AddEvent();
     return fSignalEvent;
 }
 
 void TRestRawUSTCToSignalProcess::EndProcess() {
-    for (unsigned int i = 0; i < errorevents.size(); i++) {
-        RESTWarning << "Event " << errorevents[i] << " contains error !" << RESTendl;
-    }
-    if (errorevents.size() > 0 && unknownerrors > 0) {
-        RESTWarning << "There are also " << unknownerrors << " errors from unknown events! " << RESTendl;
-    } else if (unknownerrors > 0) {
-        RESTWarning << "There are " << unknownerrors << " errors from unknown events! " << RESTendl;
+    TRestRawToSignalProcess::EndProcess();
+
+    if (errorevents.size() > 0) {
+        RESTWarning << errorevents.size() << " events contain errors" << RESTendl;
+        for (unsigned int i = 0; i < errorevents.size(); i++)
+            RESTDebug << "Event " << errorevents[i] << " contains error !" << RESTendl;
     }
 
     errorevents.clear();
@@ -234,6 +238,7 @@ bool TRestRawUSTCToSignalProcess::FillBuffer() {
         if (!GetNextFrame(frame)) {
             break;
         }
+        AddFrame();
         if (!ReadFrameData(frame)) {
             RESTWarning << "error reading frame data in file " << fCurrentFile << RESTendl;
             FixToNextFrame(fInputFiles[fCurrentFile]);
@@ -262,6 +267,7 @@ bool TRestRawUSTCToSignalProcess::FillBuffer() {
         }
 
         if (errortag) {
+            AddBadFrame();
             if (frame.evId != -1) {
                 if (errorevents.size() == 0) {
                     errorevents.push_back(frame.evId);
@@ -275,9 +281,6 @@ bool TRestRawUSTCToSignalProcess::FillBuffer() {
                         }
                     }
                 }
-
-            } else {
-                unknownerrors++;
             }
         }
 
@@ -380,41 +383,36 @@ bool TRestRawUSTCToSignalProcess::GetNextFrame(USTCDataFrame& frame) {
 // it find the next flag of frame, e.g. 0xffff or 0xac0f
 void TRestRawUSTCToSignalProcess::FixToNextFrame(FILE* f) {
     if (f == nullptr) return;
-    UChar_t buffer[PROTOCOL_SIZE];
-    int n = 0;
-    while (1) {
-        if (fread(buffer, PROTOCOL_SIZE, 1, f) != 1 || feof(f)) {
-            return;
-        }
-        n += PROTOCOL_SIZE;
 #ifdef V4_Readout_Format
-        if (!(buffer[0] ^ 0xac) && !(buffer[1] ^ 0x0f)) {
-            int flag = buffer[2] >> 5;
-            if (flag & 0x2) {
-                // we have meet the next event header
-                memcpy(fHeader, buffer, PROTOCOL_SIZE);
-                if (fread(fHeader + PROTOCOL_SIZE, HEADER_SIZE - PROTOCOL_SIZE, 1,
-                          fInputFiles[fCurrentFile]) != 1 ||
-                    feof(fInputFiles[fCurrentFile])) {
-                    fclose(f);
-                    f = nullptr;
-                    break;
-                }
-                n += HEADER_SIZE;
-                RESTWarning << "successfully switched to next frame ( + " << n << " byte)" << RESTendl;
-                RESTWarning << RESTendl;
-                break;
-            }
-        }
+    // the next event header starts with the 0xac0f protocol word and has the header flag set
+    Long64_t n = SeekToPattern(f, {0xac, 0x0f}, PROTOCOL_SIZE,
+                               [](const UChar_t* buffer) { return ((buffer[2] >> 5) & 0x2) != 0; });
 #else
-        if (!(buffer[0] ^ 0xff) && !(buffer[1] ^ 0xff) && !(buffer[2] ^ 0xff) && !(buffer[3] ^ 0xff)) {
-            RESTWarning << "successfully switched to next frame ( + " << n << " byte)" << RESTendl;
-            RESTWarning << RESTendl;
-            break;
-        }
+    Long64_t n = SeekToPattern(f, {0xff, 0xff, 0xff, 0xff}, PROTOCOL_SIZE);
 #endif
+    if (n < 0) {
+        RESTWarning << "no further frame found in file " << fCurrentFile << RESTendl;
+        return;
     }
+    fSkippedBytes += n;
     totalBytesReaded += n;
+
+#ifdef V4_Readout_Format
+    // we have meet the next event header
+    if (fread(fHeader, HEADER_SIZE, 1, f) != 1 || feof(f)) {
+        fclose(f);
+        if (fInputFiles[fCurrentFile] == f) fInputFiles[fCurrentFile] = nullptr;
+        return;
+    }
+    totalBytesReaded += HEADER_SIZE;
+#else
+    // skip the frame ending
+    UChar_t buffer[PROTOCOL_SIZE];
+    if (fread(buffer, PROTOCOL_SIZE, 1, f) != 1) return;
+    totalBytesReaded += PROTOCOL_SIZE;
+#endif
+    RESTWarning << "successfully switched to next frame ( + " << n << " byte)" << RESTendl;
+    RESTWarning << RESTendl;
 }
 
 bool TRestRawUSTCToSignalProcess::ReadFrameData(USTCDataFrame& frame) {
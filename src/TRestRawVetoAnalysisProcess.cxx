@@ -74,6 +74,30 @@
 /// "NVetoInTimeWindow" contains the number of veto signals per event, where the peak time is within the
 /// window.
 ///
+/// ### Coincidence search with preceding events
+///
+/// For long acquisition windows or continuous acquisitions, where the veto and
+/// the TPC signals may be recorded in different events, e.g. when they are built
+/// by TRestRawMultiSourceToSignalProcess, a parameter "coincidenceWindow" (in
+/// seconds) can be added. The absolute time of each veto hit, given by the event
+/// time plus the veto peak time multiplied by the parameter "samplingTime" (in
+/// seconds, 0 by default), is kept in a time sorted buffer of recent hits. The
+/// observables "VetoPrecedingCoincidence" and "NVetoPrecedingCoincidence" then
+/// flag, and count, the veto hits found in the preceding window, from
+/// coincidenceWindow before the event time up to the hits of the current event.
+/// Only the veto hits above "threshold" and not identified as noise are considered.
+///
+/// The window is one-sided since events are tagged as they are processed, and the
+/// veto hits of later events are not known yet. The events must be processed in
+/// time order, so the process runs in a single thread when the coincidence
+/// search is enabled. The search is done with a binary search over the buffer,
+/// whose size is limited by "vetoHitsBufferSize" (4096 by default).
+///
+/// \code
+/// <parameter name="coincidenceWindow" value="10e-6" />
+/// <parameter name="samplingTime" value="20e-9" />
+/// \endcode
+///
 /// ### Veto Noise Reduction
 ///
 /// The noise signals in the veto data is removed with the GetPointsOverThreshold() method. This can be
@@ -127,6 +151,8 @@
 /// 2022-Feb: Added noise removal
 ///		Konrad Altenmueller
 ///
+/// 2026-October: Added time sorted veto hits buffer for coincidences across events
+///
 /// \class      TRestRawVetoAnalysisProcess
 /// \author     Cristina Margalejo
 /// \author     Javier Galan
@@ -198,10 +224,7 @@ void TRestRawVetoAnalysisProcess::LoadConfig(const string& configFilename, const
 /// \brief Function to use in initialization of process members before starting
 /// to process the event
 ///
-void TRestRawVetoAnalysisProcess::InitProcess() {
-    // For example, try to initialize a pointer to existing metadata
-    // accessible from TRestRun
-}
+void TRestRawVetoAnalysisProcess::InitProcess() { fVetoHitTimes.clear(); }
 
 ///////////////////////////////////////////////
 /// \brief Function to initialize input/output event members and define the
@@ -260,8 +283,6 @@ TRestEvent* TRestRawVetoAnalysisProcess::ProcessEvent(TRestEvent* inputEvent) {
                     VetoMaxPeakAmplitude_map[fVetoSignalId[i]] = 0;
                 }
                 VetoPeakTime_map[fVetoSignalId[i]] = sgnl->GetMaxPeakBin();
-                // We remove the signal from the event
-                fSignalEvent->RemoveSignalWithId(fVetoSignalId[i]);
 
                 // check if signal is above threshold
                 if (sgnl->GetMaxPeakValue() > fThreshold) {
@@ -273,6 +294,13 @@ TRestEvent* TRestRawVetoAnalysisProcess::ProcessEvent(TRestEvent* inputEvent) {
                     VetoInTimeWindow = 1;
                     NVetoInTimeWindow += 1;
                 }
+                // keep the veto hit for the coincidence search
+                if (fCoincidenceWindow > 0 && VetoMaxPeakAmplitude_map[fVetoSignalId[i]] > 0 &&
+                    sgnl->GetMaxPeakValue() > fThreshold)
+                    AddVetoHit(fSignalEvent->GetTime() + sgnl->GetMaxPeakBin() * fSamplingTime);
+
+                // We remove the signal from the event, once we are done with it
+                fSignalEvent->RemoveSignalWithId(fVetoSignalId[i]);
             }
         }
 
@@ -323,8 +351,6 @@ TRestEvent* TRestRawVetoAnalysisProcess::ProcessEvent(TRestEvent* inputEvent) {
                         VetoMaxPeakAmplitude_map[groupIds[j]] = 0;
                     }
                     VetoPeakTime_map[groupIds[j]] = sgnl->GetMaxPeakBin();
-                    // We remove the signal from the event
-                    fSignalEvent->RemoveSignalWithId(groupIds[j]);
 
                     // check if signal is above threshold
                     if (sgnl->GetMaxPeakValue() > fThreshold) {
@@ -336,6 +362,13 @@ TRestEvent* TRestRawVetoAnalysisProcess::ProcessEvent(TRestEvent* inputEvent) {
                         VetoInTimeWindow = 1;
                         NVetoInTimeWindow += 1;
                     }
+                    // keep the veto hit for the coincidence search
+                    if (fCoincidenceWindow > 0 && VetoMaxPeakAmplitude_map[groupIds[j]] > 0 &&
+                        sgnl->GetMaxPeakValue() > fThreshold)
+                        AddVetoHit(fSignalEvent->GetTime() + sgnl->GetMaxPeakBin() * fSamplingTime);
+
+                    // We remove the signal from the event, once we are done with it
+                    fSignalEvent->RemoveSignalWithId(groupIds[j]);
                 }
             }
             SetObservableValue(fPeakTime[i], VetoPeakTime_map);
@@ -355,6 +388,12 @@ TRestEvent* TRestRawVetoAnalysisProcess::ProcessEvent(TRestEvent* inputEvent) {
         }
     }
 
+    if (fCoincidenceWindow > 0) {
+        Int_t NVetoCoincidence = CountVetoHits(fSignalEvent->GetTime() - fCoincidenceWindow);
+        SetObservableValue("VetoPrecedingCoincidence", (Int_t)(NVetoCoincidence > 0));
+        SetObservableValue("NVetoPrecedingCoincidence", NVetoCoincidence);
+    }
+
     if (GetVerboseLevel() >= TRestStringOutput::REST_Verbose_Level::REST_Debug) {
         fSignalEvent->PrintEvent();
 
@@ -364,6 +403,31 @@ TRestEvent* TRestRawVetoAnalysisProcess::ProcessEvent(TRestEvent* inputEvent) {
     return fSignalEvent;
 }
 
+///////////////////////////////////////////////
+/// \brief It adds a veto hit, at the given absolute time in seconds, to the
+/// time sorted buffer of recent veto hits.
+///
+/// Hits arrive usually in time order and are just appended. Otherwise they
+/// are inserted at their sorted position. The oldest hits are removed once
+/// the buffer reaches fVetoHitsBufferSize.
+///
+void TRestRawVetoAnalysisProcess::AddVetoHit(Double_t time) {
+    if (fVetoHitTimes.empty() || time >= fVetoHitTimes.back())
+        fVetoHitTimes.push_back(time);
+    else
+        fVetoHitTimes.insert(upper_bound(fVetoHitTimes.begin(), fVetoHitTimes.end(), time), time);
+
+    while ((Int_t)fVetoHitTimes.size() > fVetoHitsBufferSize) fVetoHitTimes.pop_front();
+}
+
+///////////////////////////////////////////////
+/// \brief It returns the number of veto hits recorded since the given absolute
+/// time, using a binary search on the time sorted buffer.
+///
+Int_t TRestRawVetoAnalysisProcess::CountVetoHits(Double_t since) const {
+    return fVetoHitTimes.end() - lower_bound(fVetoHitTimes.begin(), fVetoHitTimes.end(), since);
+}
+
 /// \brief Function that returns the index of a specified veto group within the group name vector and ID
 /// vector
 Int_t TRestRawVetoAnalysisProcess::GetGroupIndex(string groupName) {
@@ -397,6 +461,12 @@ void TRestRawVetoAnalysisProcess::InitFromConfigFile() {
     fSignalThreshold = potpars[1];
     fPointsOverThreshold = (Int_t)potpars[2];
 
+    fCoincidenceWindow = StringToDouble(GetParameter("coincidenceWindow", "-1"));
+    fSamplingTime = StringToDouble(GetParameter("samplingTime", "0"));
+    fVetoHitsBufferSize = StringToInteger(GetParameter("vetoHitsBufferSize", "4096"));
+    // The veto hits buffer must see all the events, in time order
+    if (fCoincidenceWindow > 0) fSingleThreadOnly = true;
+
     // **************************************************************
     // ***** Vetoes are defined as a single list ********************
     // **************************************************************
@@ -454,6 +524,11 @@ void TRestRawVetoAnalysisProcess::PrintMetadata() {
     if (fTimeWindow[0] != -1) {
         RESTMetadata << "Peak time window: (" << fTimeWindow[0] << ", " << fTimeWindow[1] << ")" << RESTendl;
     }
+    if (fCoincidenceWindow > 0) {
+        RESTMetadata << "Preceding coincidence window: " << fCoincidenceWindow << " s" << RESTendl;
+        RESTMetadata << "Sampling time: " << fSamplingTime << " s" << RESTendl;
+        RESTMetadata << "Veto hits buffer size: " << fVetoHitsBufferSize << RESTendl;
+    }
     RESTMetadata << "Noise reduction: Points over Threshold parameters = (" << fPointThreshold << ", "
                  << fSignalThreshold << ", " << fPointsOverThreshold << ")" << RESTendl;
 
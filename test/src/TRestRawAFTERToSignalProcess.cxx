@@ -0,0 +1,83 @@
+#include <TRestRawAFTERToSignalProcess.h>
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace std;
+
+namespace {
+// A single AFTER data packet as written by the DAQ (big endian words), with header, four samples
+// and the trailer CRC computed independently with zlib.crc32 over the header and data bytes
+DataPacketHeader KnownHeader() {
+    DataPacketHeader header;
+    header.size = htons(0x0018);
+    header.dcc = htons(0x0001);
+    header.hdr = htons(0x1234);
+    header.args = htons(0x0042);
+    header.ts_h = htons(0x0000);
+    header.ts_l = htons(0x0100);
+    header.ecnt = htons(0x0007);
+    header.scnt = htons(0x0004);
+    return header;
+}
+
+vector<uint16_t> KnownData() { return {htons(0x1064), htons(0x0205), htons(0x0210), htons(0x0203)}; }
+
+DataPacketEnd KnownEnd() {
+    DataPacketEnd end;
+    end.crc1 = htons(0x30ae);
+    end.crc2 = htons(0x6e2e);
+    return end;
+}
+
+uint32_t BitwiseCRC32(const unsigned char* data, size_t len) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t n = 0; n < len; n++) {
+        crc ^= data[n];
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+}  // namespace
+
+TEST(TRestRawAFTERToSignalProcess, CRC32) {
+    // Standard CRC-32 check value
+    const char* check = "123456789";
+    EXPECT_EQ(TRestRawAFTERToSignalProcess::CalculateCRC32(check, strlen(check)), 0xCBF43926u);
+
+    // The table driven implementation must agree with the bitwise one at any length and alignment
+    vector<unsigned char> bytes(300);
+    for (size_t n = 0; n < bytes.size(); n++) bytes[n] = (unsigned char)(n * 37 + 11);
+    for (size_t offset = 0; offset < 8; offset++) {
+        for (size_t len = 0; len + offset <= bytes.size(); len += 13) {
+            EXPECT_EQ(TRestRawAFTERToSignalProcess::CalculateCRC32(bytes.data() + offset, len),
+                      BitwiseCRC32(bytes.data() + offset, len));
+        }
+    }
+}
+
+TEST(TRestRawAFTERToSignalProcess, PacketCRC) {
+    DataPacketHeader header = KnownHeader();
+    vector<uint16_t> data = KnownData();
+    DataPacketEnd end = KnownEnd();
+
+    EXPECT_EQ(TRestRawAFTERToSignalProcess::GetPacketCRC(header, data.data(), data.size()), 0x30ae6e2eu);
+    EXPECT_TRUE(TRestRawAFTERToSignalProcess::CheckPacketCRC(header, data.data(), data.size(), end));
+
+    // A single flipped bit in the samples
+    data[2] ^= htons(0x0001);
+    EXPECT_FALSE(TRestRawAFTERToSignalProcess::CheckPacketCRC(header, data.data(), data.size(), end));
+    data = KnownData();
+
+    // A single flipped bit in the header
+    header.ecnt ^= htons(0x0100);
+    EXPECT_FALSE(TRestRawAFTERToSignalProcess::CheckPacketCRC(header, data.data(), data.size(), end));
+    header = KnownHeader();
+
+    // Swapped trailer words
+    swap(end.crc1, end.crc2);
+    EXPECT_FALSE(TRestRawAFTERToSignalProcess::CheckPacketCRC(header, data.data(), data.size(), end));
+}
@@ -0,0 +1,143 @@
+#include <TRestRawMultiSourceToSignalProcess.h>
+#include <TRestRawTDSToSignalProcess.h>
+#include <TRestRun.h>
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+using namespace std;
+
+namespace {
+const Int_t nSamples = 4;
+
+// It writes a TDS file with a single block of one channel events, the event k having the samples 10 * k + j
+void WriteTDSFile(const fs::path& file, uint64_t timeStamp, const vector<uint64_t>& ticks) {
+    ANABlockHead block = {};
+    block.TimeStamp = timeStamp;
+    block.SRate = 1000000;
+    block.PSize = nSamples;
+    block.NEvents = ticks.size();
+    block.NHits = ticks.size();
+
+    FILE* f = fopen(file.c_str(), "wb");
+    fwrite(&block, sizeof(block), 1, f);
+    for (size_t k = 0; k < ticks.size(); k++) {
+        ANAEventHead event = {};
+        event.clockTicksLT = ticks[k];
+        fwrite(&event, sizeof(event), 1, f);
+
+        vector<Char_t> data(nSamples);
+        for (int j = 0; j < nSamples; j++) data[j] = 10 * k + j;
+        fwrite(data.data(), 1, nSamples, f);
+    }
+    fclose(f);
+}
+
+// It writes the files of two TDS sources, and a temporary RML defining the decoder and the builder
+//
+// The events of the first source are found at 0, 10 and 30 ms. The second source is written out of
+// order, with events at 30.5 ms, 5 us and 50 ms, which the builder must sort with its buffer.
+fs::path WriteConfig(const string& requirePrimary) {
+    const auto path = fs::temp_directory_path();
+    WriteTDSFile(path / "TRestRawMultiSourceToSignalProcess_tpc.dat", 1000, {0, 10000, 30000});
+    WriteTDSFile(path / "TRestRawMultiSourceToSignalProcess_veto.dat", 1000, {30500, 5, 50000});
+
+    const auto rml = path / "TRestRawMultiSourceToSignalProcess.rml";
+    ofstream file(rml);
+    file << "<TRestRawTDSToSignalProcess name=\"scope\" />\n";
+    file << "<TRestRawMultiSourceToSignalProcess name=\"builder\" coincidenceWindow=\"1e-3\" "
+         << "bufferDepth=\"2\" requirePrimary=\"" << requirePrimary << "\" >\n";
+    file << "    <source type=\"TRestRawTDSToSignalProcess\" name=\"scope\" file=\""
+         << (path / "TRestRawMultiSourceToSignalProcess_tpc.dat").string() << "\" />\n";
+    file << "    <source type=\"TRestRawTDSToSignalProcess\" name=\"scope\" file=\""
+         << (path / "TRestRawMultiSourceToSignalProcess_veto.dat").string() << "\" idOffset=\"100\" />\n";
+    file << "</TRestRawMultiSourceToSignalProcess>\n";
+    file.close();
+
+    return rml;
+}
+
+// It checks the id and the samples of a signal taken from the event k of its source
+void ExpectSignal(const TRestRawSignal* signal, Int_t id, Int_t k) {
+    EXPECT_EQ(signal->GetSignalID(), id);
+    ASSERT_EQ(signal->GetNumberOfPoints(), nSamples);
+    for (int j = 0; j < nSamples; j++) EXPECT_EQ(signal->GetRawData(j), 10 * k + j + 128);
+}
+}  // namespace
+
+TEST(TRestRawMultiSourceToSignalProcess, Default) {
+    TRestRawMultiSourceToSignalProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "MultiSourceToSignal");
+
+    EXPECT_EQ(process.GetNumberOfSources(), 0);
+    EXPECT_EQ(process.GetCoincidenceWindow(), 1.e-6);
+    EXPECT_EQ(process.GetBufferDepth(), 8);
+}
+
+TEST(TRestRawMultiSourceToSignalProcess, FromRml) {
+    TRestRawMultiSourceToSignalProcess process(WriteConfig("false").c_str());
+
+    process.PrintMetadata();
+
+    EXPECT_EQ(process.GetNumberOfSources(), 2);
+    EXPECT_EQ(process.GetCoincidenceWindow(), 1.e-3);
+    EXPECT_EQ(process.GetBufferDepth(), 2);
+}
+
+TEST(TRestRawMultiSourceToSignalProcess, TimeOrderedMerge) {
+    TRestRawMultiSourceToSignalProcess process(WriteConfig("false").c_str());
+    TRestRun run;
+    process.SetRunInfo(&run);
+    process.InitProcess();
+
+    // Both sources at 0 ms, with the veto event read second from its file
+    auto event = (TRestRawSignalEvent*)process.ProcessEvent(nullptr);
+    ASSERT_TRUE(event != nullptr);
+    EXPECT_DOUBLE_EQ(event->GetTime(), 1000);
+    EXPECT_EQ(event->GetID(), 0);
+    ASSERT_EQ(event->GetNumberOfSignals(), 2);
+    ExpectSignal(event->GetSignal(0), 0, 0);
+    ExpectSignal(event->GetSignal(1), 100, 1);
+
+    // The first source alone at 10 ms
+    event = (TRestRawSignalEvent*)process.ProcessEvent(nullptr);
+    ASSERT_TRUE(event != nullptr);
+    EXPECT_DOUBLE_EQ(event->GetTime(), 1000.010);
+    ASSERT_EQ(event->GetNumberOfSignals(), 1);
+    ExpectSignal(event->GetSignal(0), 0, 1);
+
+    // Both sources at 30 ms, the veto event 0.5 ms later and inside the coincidence window
+    event = (TRestRawSignalEvent*)process.ProcessEvent(nullptr);
+    ASSERT_TRUE(event != nullptr);
+    EXPECT_DOUBLE_EQ(event->GetTime(), 1000.030);
+    EXPECT_EQ(event->GetID(), 2);
+    ASSERT_EQ(event->GetNumberOfSignals(), 2);
+    ExpectSignal(event->GetSignal(0), 0, 2);
+    ExpectSignal(event->GetSignal(1), 100, 0);
+
+    // The veto source alone at 50 ms
+    event = (TRestRawSignalEvent*)process.ProcessEvent(nullptr);
+    ASSERT_TRUE(event != nullptr);
+    EXPECT_DOUBLE_EQ(event->GetTime(), 1000.050);
+    ASSERT_EQ(event->GetNumberOfSignals(), 1);
+    ExpectSignal(event->GetSignal(0), 100, 2);
+
+    EXPECT_TRUE(process.ProcessEvent(nullptr) == nullptr);
+}
+
+TEST(TRestRawMultiSourceToSignalProcess, RequirePrimary) {
+    TRestRawMultiSourceToSignalProcess process(WriteConfig("true").c_str());
+    TRestRun run;
+    process.SetRunInfo(&run);
+    process.InitProcess();
+
+    // The combined event at 50 ms has no event from the first source
+    Int_t events = 0;
+    while (process.ProcessEvent(nullptr) != nullptr) events++;
+    EXPECT_EQ(events, 3);
+    EXPECT_EQ(process.GetOrphanEvents(), 1);
+}
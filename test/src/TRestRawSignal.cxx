@@ -1,7 +1,10 @@
 
+#include <TMath.h>
 #include <TRestRawSignal.h>
 #include <gtest/gtest.h>
 
+#include <numeric>
+
 using namespace std;
 
 TEST(TRestRawSignal, Default) {
@@ -9,3 +12,255 @@ TEST(TRestRawSignal, Default) {
 
     EXPECT_TRUE(rawSignal.GetIntegral() == 0);
 }
+
+TEST(TRestRawSignal, FindPulses) {
+    TRestRawSignal rawSignal(0);
+    for (int i = 0; i < 512; i++) {
+        Double_t value = 1000 + 200 * TMath::Gaus(i, 100, 5) + 120 * TMath::Gaus(i, 125, 5);
+        rawSignal.AddPoint((Short_t)value);
+    }
+
+    rawSignal.CalculateBaseLine(10, 60);
+    rawSignal.fBaseLineSigma = 1;
+    rawSignal.InitializePointsOverThreshold(TVector2(3, 3), 5);
+
+    vector<TRestRawSignal::Pulse> pulses;
+    EXPECT_EQ(rawSignal.FindPulses(pulses, 10), 2);
+
+    EXPECT_EQ(pulses[0].peakBin, 100);
+    EXPECT_EQ(pulses[1].peakBin, 125);
+    EXPECT_EQ(pulses[0].end, pulses[1].start);
+    EXPECT_DOUBLE_EQ(pulses[0].amplitude, 200);
+    EXPECT_DOUBLE_EQ(pulses[0].integral + pulses[1].integral, rawSignal.GetThresholdIntegral());
+}
+
+TEST(TRestRawSignal, SubBinTiming) {
+    TRestRawSignal rawSignal(0);
+    for (int i = 0; i < 512; i++) rawSignal.AddPoint((Short_t)(1000 + 1000 * TMath::Gaus(i, 100.5, 4)));
+
+    rawSignal.CalculateBaseLine(10, 60);
+
+    EXPECT_EQ(rawSignal.GetMaxPeakBin(), 100);
+    EXPECT_NEAR(rawSignal.GetMaxPeakTime(), 100.5, 0.05);
+    EXPECT_NEAR(rawSignal.GetMaxPeakTime("GAUSSIAN"), 100.5, 0.05);
+    EXPECT_NEAR(rawSignal.GetMaxPeakTime("SINC"), 100.5, 0.05);
+
+    // The same refinement is available for any given maximum, as the peak of a pulse
+    EXPECT_DOUBLE_EQ(rawSignal.GetMaxPeakTime(100), rawSignal.GetMaxPeakTime());
+    EXPECT_DOUBLE_EQ(rawSignal.GetMaxPeakTime(0), 0);
+    EXPECT_DOUBLE_EQ(rawSignal.GetMaxPeakTime(511), 511);
+
+    // Half amplitude is reached at 100.5 - 4 * sqrt(2 ln 2)
+    EXPECT_NEAR(rawSignal.GetConstantFractionTime(0.5), 95.79, 0.1);
+    EXPECT_DOUBLE_EQ(rawSignal.GetThresholdCrossingTime(2000), -1);
+}
+
+TEST(TRestRawSignal, SavitzkyGolay) {
+    const auto& smoothing = TRestRawSignal::GetSavitzkyGolayCoefficients(2, 2);
+    ASSERT_EQ(smoothing.size(), 5);
+    EXPECT_NEAR(smoothing[0] * 35, -3, 1.e-9);
+    EXPECT_NEAR(smoothing[2] * 35, 17, 1.e-9);
+
+    EXPECT_TRUE(TRestRawSignal::GetSavitzkyGolayCoefficients(1, 3).empty());
+
+    TRestRawSignal rawSignal(0);
+    for (int i = 0; i < 100; i++) rawSignal.AddPoint((Short_t)(i * i - 50 * i + 700));
+
+    // A quadratic signal is not modified by the smoothing, and its derivative is exact
+    vector<Float_t> smoothed, derivative;
+    rawSignal.GetSignalSavitzkyGolay(smoothed, 3, 2);
+    rawSignal.GetSignalSavitzkyGolay(derivative, 3, 3, 1);
+
+    ASSERT_EQ(smoothed.size(), 100);
+    for (int i = 3; i < 97; i++) {
+        EXPECT_NEAR(smoothed[i], rawSignal.GetRawData(i), 0.01);
+        EXPECT_NEAR(derivative[i], 2 * i - 50, 0.01);
+    }
+}
+
+TEST(TRestRawSignal, RemoveSpikes) {
+    TRestRawSignal rawSignal(0);
+    for (int i = 0; i < 512; i++) rawSignal.AddPoint((Short_t)(250 + 1000 * TMath::Gaus(i, 200, 6)));
+
+    TRestRawSignal original = rawSignal;
+    rawSignal.IncreaseBinBy(50, 400);
+    rawSignal.IncreaseBinBy(300, -300);
+
+    // Only the two spikes are replaced, the pulse shape is preserved
+    EXPECT_EQ(rawSignal.RemoveSpikes(30, 5), 2);
+    for (int i = 0; i < 512; i++) EXPECT_EQ(rawSignal.GetRawData(i), original.GetRawData(i));
+
+    EXPECT_EQ(rawSignal.RemoveSpikes(30, 3), 0);
+}
+
+TEST(TRestRawSignal, FractionalShift) {
+    TRestRawSignal rawSignal(0);
+    for (int i = 0; i < 256; i++) rawSignal.AddPoint((Short_t)(1000 * TMath::Gaus(i, 100, 5)));
+
+    vector<Float_t> shifted;
+    rawSignal.GetSignalShifted(shifted, 3);
+    ASSERT_EQ(shifted.size(), 256);
+    for (int i = 20; i < 236; i++) EXPECT_NEAR(shifted[i], rawSignal.GetRawData(i - 3), 1.e-3);
+
+    // A positive shift delays the pulse
+    for (const string option : {"SINC", "CUBIC", "FFT"}) {
+        rawSignal.GetSignalShifted(shifted, 0.5, option);
+        for (int i = 20; i < 236; i++) EXPECT_NEAR(shifted[i], 1000 * TMath::Gaus(i - 0.5, 100, 5), 1.5);
+    }
+}
+
+TEST(TRestRawSignal, Decimation) {
+    TRestRawSignal rawSignal(0);
+    for (int i = 0; i < 512; i++) rawSignal.AddPoint(i);
+
+    vector<Float_t> decimated;
+    rawSignal.GetSignalDecimated(decimated, 4, "AVERAGE");
+    ASSERT_EQ(decimated.size(), 128);
+    EXPECT_FLOAT_EQ(decimated[10], 41.5);
+
+    // The points are placed at the center of the new bins
+    rawSignal.GetSignalDecimated(decimated, 4);
+    ASSERT_EQ(decimated.size(), 128);
+    for (int k = 5; k < 123; k++) EXPECT_NEAR(decimated[k], 4 * k + 1.5, 1.e-2);
+}
+
+TEST(TRestRawSignal, Crop) {
+    TRestRawSignal rawSignal(0);
+    for (int i = 0; i < 512; i++) rawSignal.AddPoint(i == 200 ? 1000 : 10);
+    EXPECT_EQ(rawSignal.GetStartBin(), 0);
+
+    rawSignal.Crop(150, 300);
+    ASSERT_EQ(rawSignal.GetNumberOfPoints(), 150);
+    EXPECT_EQ(rawSignal.GetStartBin(), 150);
+    EXPECT_EQ(rawSignal.GetStartBin() + rawSignal.GetMaxPeakBin(), 200);
+
+    // The range is constrained to the existing points, and the start bin is accumulated
+    rawSignal.Crop(40, 1000);
+    ASSERT_EQ(rawSignal.GetNumberOfPoints(), 110);
+    EXPECT_EQ(rawSignal.GetStartBin(), 190);
+    EXPECT_EQ(rawSignal.GetStartBin() + rawSignal.GetMaxPeakBin(), 200);
+}
+
+TEST(TRestRawSignal, CropBaseLine) {
+    TRestRawSignal rawSignal(0);
+    for (int i = 0; i < 512; i++) rawSignal.AddPoint(i < 100 ? (i % 2 ? 110 : 90) : (i < 200 ? 500 : 100));
+    rawSignal.Crop(50, 300);
+    ASSERT_EQ(rawSignal.GetStartBin(), 50);
+
+    // The baseline range is given in bins of the stored data points
+    rawSignal.CalculateBaseLine(0, 50);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLine(), 100);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLineSigma(), 10);
+
+    rawSignal.CalculateBaseLine(0, 50, "ROBUST");
+    EXPECT_NEAR(rawSignal.GetBaseLine(), 100, 10);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLineSigma(), 20 / 1.349);
+
+    // The range is constrained to the existing points
+    rawSignal.CalculateBaseLine(200, 1000);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLine(), 100);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLineSigma(), 0);
+
+    rawSignal.CalculateBaseLine(200, 1000, "ROBUST");
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLine(), 100);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLineSigma(), 0);
+
+    rawSignal.CalculateBaseLine(-10, 40);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLine(), 100);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLineSigma(), 10);
+
+    rawSignal.CalculateBaseLine(300, 400);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLine(), 0);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLineSigma(), 0);
+}
+
+TEST(TRestRawSignal, Calibrate) {
+    TRestRawSignal rawSignal(0);
+    for (int i = 0; i < 100; i++) rawSignal.AddPoint(i % 2 ? 110 : 90);
+    rawSignal.AddPoint(30000);
+
+    rawSignal.CalculateBaseLine(0, 100);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLine(), 100);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLineSigma(), 10);
+
+    // The offset moves the baseline, but not its fluctuation
+    rawSignal.AddOffset(20);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLine(), 120);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLineSigma(), 10);
+
+    rawSignal.Calibrate(1.5, -30);
+    EXPECT_EQ(rawSignal.GetRawData(0), 135);
+    EXPECT_EQ(rawSignal.GetRawData(1), 165);
+    EXPECT_EQ(rawSignal.GetRawData(100), 32767);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLine(), 150);
+    EXPECT_FLOAT_EQ(rawSignal.GetBaseLineSigma(), 15);
+}
+
+TEST(TRestRawSignal, RoundedPoints) {
+    TRestRawSignal rawSignal(0);
+    rawSignal.AddRoundedPoint(10.4);
+    rawSignal.AddRoundedPoint(10.5);
+    rawSignal.AddRoundedPoint(-10.6);
+    rawSignal.AddRoundedPoint(40000);
+    rawSignal.AddRoundedPoint(-40000);
+
+    EXPECT_FALSE(rawSignal.IsFloat());
+    EXPECT_EQ(rawSignal[0], 10);
+    EXPECT_EQ(rawSignal[1], 11);
+    EXPECT_EQ(rawSignal[2], -11);
+    EXPECT_EQ(rawSignal[3], 32767);
+    EXPECT_EQ(rawSignal[4], -32768);
+}
+
+TEST(TRestRawSignal, FloatSamples) {
+    TRestRawSignal rawSignal(0);
+    for (int i = 0; i < 10; i++) rawSignal.AddPoint(100 + i);
+    EXPECT_FALSE(rawSignal.IsFloat());
+
+    // The fractional part is kept, and the Short_t values are rounded when they are read
+    rawSignal.ConvertToFloat();
+    rawSignal.Calibrate(0.25, 0.1);
+    EXPECT_TRUE(rawSignal.IsFloat());
+    EXPECT_FLOAT_EQ(rawSignal.GetRawData(1), 25.35);
+    EXPECT_EQ(rawSignal[1], 25);
+    EXPECT_FLOAT_EQ(rawSignal.GetRawData(3), 25.85);
+    EXPECT_EQ(rawSignal[3], 26);
+
+    rawSignal.AddFloatPoint(-40000.5);
+    EXPECT_EQ(rawSignal.GetNumberOfPoints(), 11);
+    EXPECT_EQ(rawSignal[10], -32768);
+
+    rawSignal.Crop(1, 4);
+    EXPECT_EQ(rawSignal.GetNumberOfPoints(), 3);
+    EXPECT_FLOAT_EQ(rawSignal.GetRawData(0), 25.35);
+
+    rawSignal.ConvertToShort();
+    EXPECT_FALSE(rawSignal.IsFloat());
+    EXPECT_EQ(rawSignal.GetRawData(0), 25);
+}
+
+TEST(TRestRawSignal, FixedSamples) {
+    // The kernels specialized for 512 samples and the generic ones must agree
+    for (int nPoints : {512, 511}) {
+        vector<Int_t> data(nPoints);
+        for (int i = 0; i < nPoints; i++) data[i] = 250 + (i % 7) - 3;
+        data[300] += 400;
+        data[301] += 200;
+        data[100] -= 50;
+
+        TRestRawSignal rawSignal(0);
+        rawSignal.AddPoints(data.data(), nPoints);
+        EXPECT_EQ(rawSignal.GetNumberOfPoints(), nPoints);
+        EXPECT_EQ(rawSignal.GetRawData(300), 653);
+
+        rawSignal.CalculateBaseLine(0, nPoints);
+        Double_t mean = std::accumulate(data.begin(), data.end(), 0.) / nPoints;
+        EXPECT_FLOAT_EQ(rawSignal.GetBaseLine(), mean);
+
+        EXPECT_EQ(rawSignal.GetMaxPeakBin(), 300);
+        EXPECT_EQ(rawSignal.GetMinPeakBin(), 100);
+
+        rawSignal.InitializePointsOverThreshold(TVector2(3, 0), 1);
+        EXPECT_EQ(rawSignal.GetPointsOverThreshold().size(), 2);
+    }
+}
@@ -0,0 +1,80 @@
+#include <TRestRawSignalCalibrationProcess.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <limits>
+
+namespace fs = std::filesystem;
+
+using namespace std;
+
+const auto filesPath = fs::path(__FILE__).parent_path().parent_path() / "files";
+const auto calibrationFile = filesPath / "TRestRawSignalCalibrationProcess.txt";
+
+namespace {
+// An event with the signals 1, 2 and 3, with values from 1 to 200, and a last value of 20000
+TRestRawSignalEvent HandBuiltEvent() {
+    TRestRawSignalEvent event;
+    for (int id = 1; id <= 3; id++) {
+        TRestRawSignal signal;
+        signal.SetSignalID(id);
+        for (int n = 1; n <= 200; n++) signal.AddPoint(n);
+        signal.AddPoint(20000);
+        event.AddSignal(signal);
+    }
+    return event;
+}
+}  // namespace
+
+TEST(TRestRawSignalCalibrationProcess, TestFiles) {
+    cout << "Test files path: " << filesPath << endl;
+
+    // Check dir exists and is a directory
+    EXPECT_TRUE(fs::is_directory(filesPath));
+    // Check it's not empty
+    EXPECT_TRUE(!fs::is_empty(filesPath));
+    EXPECT_TRUE(fs::exists(calibrationFile));
+}
+
+TEST(TRestRawSignalCalibrationProcess, Default) {
+    TRestRawSignalCalibrationProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "rawSignalCalibration");
+
+    EXPECT_TRUE(process.GetCalibrationFile() == "");
+    EXPECT_TRUE(process.GetSampleType() == "");
+}
+
+TEST(TRestRawSignalCalibrationProcess, Short) {
+    TRestRawSignalCalibrationProcess process;
+    process.SetCalibrationFile(calibrationFile.c_str());
+    process.InitProcess();
+
+    TRestRawSignalEvent event = HandBuiltEvent();
+    process.ProcessEvent(&event);
+
+    // The channel 2 is not in the calibration file, and it is not modified. The values are rounded half up.
+    for (int n = 0; n < 200; n++) {
+        EXPECT_EQ(event.GetSignal(0)->GetRawData(n), 2 * (n + 1) - 100);
+        EXPECT_EQ(event.GetSignal(1)->GetRawData(n), n + 1);
+        EXPECT_EQ(event.GetSignal(2)->GetRawData(n), (n + 1 + 21) / 2);
+    }
+
+    // The calibrated values are saturated to the Short_t range
+    EXPECT_EQ(event.GetSignal(0)->GetRawData(200), numeric_limits<Short_t>::max());
+    EXPECT_EQ(event.GetSignal(2)->GetRawData(200), 10010);
+}
+
+TEST(TRestRawSignalCalibrationProcess, Float) {
+    TRestRawSignalCalibrationProcess process;
+    process.SetCalibrationFile(calibrationFile.c_str());
+    process.SetSampleType("float");
+    process.InitProcess();
+
+    TRestRawSignalEvent event = HandBuiltEvent();
+    process.ProcessEvent(&event);
+
+    // The float samples keep the fractional part and the values out of the Short_t range
+    for (int s = 0; s < 3; s++) EXPECT_TRUE(event.GetSignal(s)->IsFloat());
+    for (int n = 0; n < 200; n++) EXPECT_DOUBLE_EQ(event.GetSignal(2)->GetRawData(n), 0.5 * (n + 1) + 10);
+    EXPECT_DOUBLE_EQ(event.GetSignal(0)->GetRawData(200), 39900);
+}
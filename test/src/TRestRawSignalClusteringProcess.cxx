@@ -0,0 +1,80 @@
+#include <TRestRawSignalClusteringProcess.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+using namespace std;
+
+const auto filesPath = fs::path(__FILE__).parent_path().parent_path() / "files";
+const auto restRawSignalClusteringProcessRml = filesPath / "TRestRawSignalClusteringProcess.rml";
+
+namespace {
+// A signal with a small baseline fluctuation, and a triangular pulse of 20 bins starting at t0
+TRestRawSignal Pulse(Int_t id, Int_t t0, Double_t amplitude) {
+    TRestRawSignal signal;
+    signal.SetSignalID(id);
+    for (int n = 0; n < 256; n++) {
+        const Double_t pulse = (n >= t0 && n < t0 + 20) ? amplitude * (10 - abs(n - t0 - 10)) / 10 : 0;
+        signal.AddPoint((Short_t)(100 + (n * 7 + id) % 5 + pulse));
+    }
+    return signal;
+}
+}  // namespace
+
+TEST(TRestRawSignalClusteringProcess, TestFiles) {
+    cout << "Test files path: " << filesPath << endl;
+
+    // Check dir exists and is a directory
+    EXPECT_TRUE(fs::is_directory(filesPath));
+    // Check it's not empty
+    EXPECT_TRUE(!fs::is_empty(filesPath));
+    EXPECT_TRUE(fs::exists(restRawSignalClusteringProcessRml));
+}
+
+TEST(TRestRawSignalClusteringProcess, Default) {
+    TRestRawSignalClusteringProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "rawSignalClustering");
+
+    EXPECT_TRUE(process.GetNeighbours() == "readout");
+    EXPECT_TRUE(process.GetTimeTolerance() == 0);
+}
+
+TEST(TRestRawSignalClusteringProcess, FromRml) {
+    TRestRawSignalClusteringProcess process(restRawSignalClusteringProcessRml.c_str());
+
+    process.PrintMetadata();
+
+    EXPECT_TRUE(process.GetNeighbours() == "daq");
+    EXPECT_TRUE(process.GetTimeTolerance() == 2);
+}
+
+TEST(TRestRawSignalClusteringProcess, Clusters) {
+    TRestRawSignalClusteringProcess process(restRawSignalClusteringProcessRml.c_str());
+    process.InitProcess();
+
+    TRestRawSignalEvent event;
+    vector<TRestRawSignal> signals = {
+        Pulse(10, 100, 200),  // Overlaps with 11
+        Pulse(11, 110, 200),
+        Pulse(12, 150, 200),  // Neighbour of 11, but 20 bins later. Overlaps with 13
+        Pulse(13, 155, 50),
+        Pulse(20, 100, 300),  // Isolated
+        Pulse(30, 100, 0),    // Not active
+    };
+    for (auto& signal : signals) event.AddSignal(signal);
+
+    process.ProcessEvent(&event);
+
+    // The clusters are numbered in input order
+    EXPECT_EQ(process.GetClusterSizes(), vector<Int_t>({2, 2, 1}));
+    ASSERT_EQ(process.GetClusterCharges().size(), 3);
+    EXPECT_GT(process.GetClusterCharges()[0], process.GetClusterCharges()[1]);
+    EXPECT_GT(process.GetClusterCharges()[2], process.GetClusterCharges()[1]);
+
+    // The channels 11 and 12 are joined with a larger time tolerance
+    process.SetTimeTolerance(25);
+    process.ProcessEvent(&event);
+    EXPECT_EQ(process.GetClusterSizes(), vector<Int_t>({4, 1}));
+}
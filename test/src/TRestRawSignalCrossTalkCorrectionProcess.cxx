@@ -0,0 +1,69 @@
+#include <TMath.h>
+#include <TRestRawSignalCrossTalkCorrectionProcess.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+using namespace std;
+
+const auto filesPath = fs::path(__FILE__).parent_path().parent_path() / "files";
+const auto couplingFile = filesPath / "TRestRawSignalCrossTalkCorrectionProcess.txt";
+
+TEST(TRestRawSignalCrossTalkCorrectionProcess, TestFiles) {
+    cout << "Test files path: " << filesPath << endl;
+
+    // Check dir exists and is a directory
+    EXPECT_TRUE(fs::is_directory(filesPath));
+    // Check it's not empty
+    EXPECT_TRUE(!fs::is_empty(filesPath));
+    EXPECT_TRUE(fs::exists(couplingFile));
+}
+
+TEST(TRestRawSignalCrossTalkCorrectionProcess, Default) {
+    TRestRawSignalCrossTalkCorrectionProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "rawSignalCrossTalkCorrection");
+
+    EXPECT_TRUE(process.GetCouplingFile() == "");
+    EXPECT_TRUE(process.GetNumberOfCouplings() == 0);
+}
+
+TEST(TRestRawSignalCrossTalkCorrectionProcess, Correction) {
+    TRestRawSignalCrossTalkCorrectionProcess process;
+    process.SetCouplingFile(couplingFile.c_str());
+    process.InitProcess();
+
+    // The self-coupling of the channel 2 is ignored
+    EXPECT_TRUE(process.GetNumberOfCouplings() == 2);
+
+    // A pulse at the channel 1 induces 10% of its amplitude at the channel 2, and -5% at the channel 3,
+    // which is not present in the event. The channel 4 does not couple to any other channel.
+    auto pulse = [](Int_t n) { return 1000 * TMath::Gaus(n, 150, 10); };
+
+    TRestRawSignalEvent event;
+    vector<vector<Double_t>> expected;
+    for (int id : {4, 2, 1}) {
+        TRestRawSignal signal;
+        signal.SetSignalID(id);
+        expected.emplace_back();
+        for (int n = 0; n < 256; n++) {
+            const Double_t clean = 250 + (id == 1 ? pulse(n) : 0);
+            const Double_t induced = id == 2 ? 0.1 * pulse(n) : 0;
+            signal.AddRoundedPoint(clean + induced);
+            expected.back().push_back(clean);
+        }
+        event.AddSignal(signal);
+    }
+
+    const auto output = (TRestRawSignalEvent*)process.ProcessEvent(&event);
+
+    // The output keeps the order of the input signals
+    ASSERT_EQ(output->GetNumberOfSignals(), 3);
+    for (int s = 0; s < 3; s++) {
+        const TRestRawSignal* corrected = output->GetSignal(s);
+        EXPECT_EQ(corrected->GetID(), event.GetSignal(s)->GetID());
+        ASSERT_EQ(corrected->GetNumberOfPoints(), 256);
+        for (int n = 0; n < 256; n++) EXPECT_NEAR(corrected->GetRawData(n), expected[s][n], 1);
+    }
+}
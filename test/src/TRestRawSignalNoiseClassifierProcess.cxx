@@ -0,0 +1,88 @@
+#include <TRestRawSignalNoiseClassifierProcess.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+using namespace std;
+
+const auto filesPath = fs::path(__FILE__).parent_path().parent_path() / "files";
+const auto linearModelFile = filesPath / "TRestRawSignalNoiseClassifierProcessLinear.txt";
+const auto treesModelFile = filesPath / "TRestRawSignalNoiseClassifierProcessTrees.txt";
+
+namespace {
+// A signal with a small baseline fluctuation, a triangular pulse of 20 bins starting at bin 200, and a
+// single point spike at bin 300
+TRestRawSignal Signal(Int_t id, Double_t pulseAmplitude, Double_t spikeAmplitude) {
+    TRestRawSignal signal;
+    signal.SetSignalID(id);
+    for (int n = 0; n < 512; n++) {
+        Double_t value = 100 + (n * 7 + id) % 5;
+        if (n >= 200 && n < 220) value += pulseAmplitude * (10 - abs(n - 210)) / 10;
+        if (n == 300) value += spikeAmplitude;
+        signal.AddPoint((Short_t)value);
+    }
+    return signal;
+}
+
+// An event with a pulse at the signal 1, only noise at the signal 2, and a spike at the signal 3
+TRestRawSignalEvent HandBuiltEvent() {
+    TRestRawSignalEvent event;
+    vector<TRestRawSignal> signals = {Signal(1, 200, 0), Signal(2, 0, 0), Signal(3, 0, 100)};
+    for (auto& signal : signals) event.AddSignal(signal);
+    return event;
+}
+}  // namespace
+
+TEST(TRestRawSignalNoiseClassifierProcess, TestFiles) {
+    cout << "Test files path: " << filesPath << endl;
+
+    // Check dir exists and is a directory
+    EXPECT_TRUE(fs::is_directory(filesPath));
+    // Check it's not empty
+    EXPECT_TRUE(!fs::is_empty(filesPath));
+    EXPECT_TRUE(fs::exists(linearModelFile));
+    EXPECT_TRUE(fs::exists(treesModelFile));
+}
+
+TEST(TRestRawSignalNoiseClassifierProcess, Default) {
+    TRestRawSignalNoiseClassifierProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "rawSignalNoiseClassifier");
+
+    EXPECT_TRUE(process.GetModelFile() == "");
+    EXPECT_TRUE(process.GetModelType() == "linear");
+    EXPECT_TRUE(process.GetAction() == "tag");
+}
+
+TEST(TRestRawSignalNoiseClassifierProcess, Linear) {
+    // The score is the maximum over sigma minus 10
+    TRestRawSignalNoiseClassifierProcess process;
+    process.SetModelFile(linearModelFile.c_str());
+    process.InitProcess();
+
+    TRestRawSignalEvent event = HandBuiltEvent();
+    process.ProcessEvent(&event);
+
+    // The noise signals are only tagged
+    EXPECT_EQ(process.GetNoiseIds(), vector<Int_t>({2}));
+    EXPECT_EQ(event.GetNumberOfSignals(), 3);
+}
+
+TEST(TRestRawSignalNoiseClassifierProcess, Trees) {
+    // The first tree selects the signals with more than 3 points over threshold, and the second one the
+    // signals with a maximum over 10 sigmas, which is not enough to compensate a narrow spike
+    TRestRawSignalNoiseClassifierProcess process;
+    process.SetModelFile(treesModelFile.c_str());
+    process.SetModelType("trees");
+    process.SetAction("drop");
+    process.InitProcess();
+
+    TRestRawSignalEvent event = HandBuiltEvent();
+    process.ProcessEvent(&event);
+
+    // The noise signals are removed from the event
+    EXPECT_EQ(process.GetNoiseIds(), vector<Int_t>({2, 3}));
+    ASSERT_EQ(event.GetNumberOfSignals(), 1);
+    EXPECT_EQ(event.GetSignal(0)->GetID(), 1);
+}
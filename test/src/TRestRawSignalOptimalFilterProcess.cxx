@@ -0,0 +1,76 @@
+#include <TFile.h>
+#include <TMath.h>
+#include <TRestRawSignalOptimalFilterProcess.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+using namespace std;
+
+namespace {
+const Int_t nPoints = 256;
+
+// A pulse starting at bin t0, with its maximum 10 bins later, which vanishes before the end of the window
+Double_t Pulse(Int_t n, Double_t t0) {
+    if (n < t0) return 0;
+    const Double_t t = (n - t0) / 10.;
+    return 1000 * TMath::Power(t, 3) * TMath::Exp(3 - 3 * t);
+}
+
+// It writes a template peaking at bin 70 to a temporary ROOT file, and returns the file path
+fs::path WriteTemplate() {
+    const auto templateFile = fs::temp_directory_path() / "TRestRawSignalOptimalFilterProcess.root";
+
+    TRestRawSignal response;
+    for (int n = 0; n < nPoints; n++) response.AddPoint((Short_t)TMath::Nint(Pulse(n, 60)));
+
+    TFile file(templateFile.c_str(), "RECREATE");
+    response.Write("signal Response");
+    file.Close();
+
+    return templateFile;
+}
+}  // namespace
+
+TEST(TRestRawSignalOptimalFilterProcess, Default) {
+    TRestRawSignalOptimalFilterProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "rawSignalOptimalFilter");
+
+    EXPECT_TRUE(process.GetTemplateFile() == "");
+    EXPECT_TRUE(process.GetTemplateName() == "signal Response");
+    EXPECT_FALSE(process.GetTimeSearch());
+}
+
+TEST(TRestRawSignalOptimalFilterProcess, AmplitudeAndShift) {
+    const auto templateFile = WriteTemplate();
+
+    // The template scaled by 2.5 and delayed by 12 bins, on top of a baseline
+    TRestRawSignalEvent event;
+    TRestRawSignal signal;
+    signal.SetSignalID(7);
+    for (int n = 0; n < nPoints; n++) signal.AddPoint((Short_t)TMath::Nint(250 + 2.5 * Pulse(n, 72)));
+    event.AddSignal(signal);
+
+    TRestRawSignalOptimalFilterProcess process;
+    process.SetTemplateFile(templateFile.c_str());
+    process.SetTimeSearch(true);
+    process.InitProcess();
+    process.ProcessEvent(&event);
+
+    ASSERT_EQ(process.GetAmplitudes().count(7), 1);
+    EXPECT_NEAR(process.GetAmplitudes().at(7), 2500, 2.5);
+    EXPECT_EQ(process.GetTimes().at(7), 70 + 12);
+
+    // Without the time search the amplitude is only estimated at the template position
+    TRestRawSignalOptimalFilterProcess fixedTime;
+    fixedTime.SetTemplateFile(templateFile.c_str());
+    fixedTime.InitProcess();
+    fixedTime.ProcessEvent(&event);
+
+    EXPECT_LT(fixedTime.GetAmplitudes().at(7), 2500 / 2.);
+    EXPECT_TRUE(fixedTime.GetTimes().empty());
+
+    fs::remove(templateFile);
+}
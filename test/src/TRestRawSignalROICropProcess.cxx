@@ -0,0 +1,94 @@
+#include <TRestRawSignalROICropProcess.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+using namespace std;
+
+const auto filesPath = fs::path(__FILE__).parent_path().parent_path() / "files";
+const auto restRawSignalROICropProcessRml = filesPath / "TRestRawSignalROICropProcess.rml";
+
+namespace {
+// A signal with a small baseline fluctuation, and a triangular pulse covering the bins t0+1 to t0+19
+TRestRawSignal Pulse(Int_t id, Int_t t0, Double_t amplitude) {
+    TRestRawSignal signal;
+    signal.SetSignalID(id);
+    for (int n = 0; n < 512; n++) {
+        const Double_t pulse = (n >= t0 && n < t0 + 20) ? amplitude * (10 - abs(n - t0 - 10)) / 10 : 0;
+        signal.AddPoint((Short_t)(100 + (n * 7 + id) % 5 + pulse));
+    }
+    return signal;
+}
+
+// It checks that the signal keeps the points of the original signal from the given bin
+void ExpectCropped(const TRestRawSignal* cropped, const TRestRawSignal& original, Int_t startBin,
+                   Int_t nPoints) {
+    EXPECT_EQ(cropped->GetStartBin(), startBin);
+    ASSERT_EQ(cropped->GetNumberOfPoints(), nPoints);
+    for (int n = 0; n < nPoints; n++) EXPECT_EQ(cropped->GetRawData(n), original.GetRawData(startBin + n));
+}
+}  // namespace
+
+TEST(TRestRawSignalROICropProcess, TestFiles) {
+    cout << "Test files path: " << filesPath << endl;
+
+    // Check dir exists and is a directory
+    EXPECT_TRUE(fs::is_directory(filesPath));
+    // Check it's not empty
+    EXPECT_TRUE(!fs::is_empty(filesPath));
+    EXPECT_TRUE(fs::exists(restRawSignalROICropProcessRml));
+}
+
+TEST(TRestRawSignalROICropProcess, Default) {
+    TRestRawSignalROICropProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "rawSignalROICrop");
+
+    EXPECT_TRUE(process.GetMode() == "peak");
+    EXPECT_TRUE(process.GetPreSamples() == 64);
+    EXPECT_TRUE(process.GetPostSamples() == 128);
+}
+
+TEST(TRestRawSignalROICropProcess, FromRml) {
+    TRestRawSignalROICropProcess process(restRawSignalROICropProcessRml.c_str());
+
+    process.PrintMetadata();
+
+    EXPECT_TRUE(process.GetMode() == "threshold");
+    EXPECT_TRUE(process.GetPreSamples() == 20);
+    EXPECT_TRUE(process.GetPostSamples() == 30);
+}
+
+TEST(TRestRawSignalROICropProcess, Peak) {
+    TRestRawSignalROICropProcess process;
+    process.InitProcess();
+
+    TRestRawSignal original = Pulse(1, 200, 200);
+    TRestRawSignalEvent event;
+    event.AddSignal(original);
+
+    process.ProcessEvent(&event);
+
+    // The peak is at the bin 210
+    ASSERT_EQ(event.GetNumberOfSignals(), 1);
+    ExpectCropped(event.GetSignal(0), original, 210 - 64, 64 + 128 + 1);
+}
+
+TEST(TRestRawSignalROICropProcess, Threshold) {
+    TRestRawSignalROICropProcess process(restRawSignalROICropProcessRml.c_str());
+    process.InitProcess();
+
+    vector<TRestRawSignal> signals = {Pulse(1, 200, 200), Pulse(2, 200, 0), Pulse(3, 480, 200)};
+    TRestRawSignalEvent event;
+    for (auto& signal : signals) event.AddSignal(signal);
+
+    process.ProcessEvent(&event);
+
+    // The signal without pulse is removed, and the region of the signal 3 is limited by the window end
+    ASSERT_EQ(event.GetNumberOfSignals(), 2);
+    EXPECT_EQ(event.GetSignal(0)->GetID(), 1);
+    EXPECT_EQ(event.GetSignal(1)->GetID(), 3);
+    ExpectCropped(event.GetSignal(0), signals[0], 201 - 20, 219 - 201 + 1 + 20 + 30);
+    ExpectCropped(event.GetSignal(1), signals[2], 481 - 20, 512 - 481 + 20);
+}
@@ -0,0 +1,74 @@
+#include <TMath.h>
+#include <TRestRawSignalRecursiveFilterProcess.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+using namespace std;
+
+const auto filesPath = fs::path(__FILE__).parent_path().parent_path() / "files";
+const auto restRawSignalRecursiveFilterProcessRml = filesPath / "TRestRawSignalRecursiveFilterProcess.rml";
+
+TEST(TRestRawSignalRecursiveFilterProcess, TestFiles) {
+    cout << "Test files path: " << filesPath << endl;
+
+    // Check dir exists and is a directory
+    EXPECT_TRUE(fs::is_directory(filesPath));
+    // Check it's not empty
+    EXPECT_TRUE(!fs::is_empty(filesPath));
+    EXPECT_TRUE(fs::exists(restRawSignalRecursiveFilterProcessRml));
+}
+
+TEST(TRestRawSignalRecursiveFilterProcess, Default) {
+    TRestRawSignalRecursiveFilterProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "rawSignalRecursiveFilter");
+
+    EXPECT_TRUE(process.GetFilterType() == "crrc");
+    EXPECT_TRUE(process.GetShapingTime() == 10);
+    EXPECT_TRUE(process.GetOrder() == 4);
+    EXPECT_TRUE(process.GetGain() == 1);
+}
+
+TEST(TRestRawSignalRecursiveFilterProcess, FromRml) {
+    TRestRawSignalRecursiveFilterProcess process(restRawSignalRecursiveFilterProcessRml.c_str());
+
+    process.PrintMetadata();
+
+    EXPECT_TRUE(process.GetFilterType() == "trapezoidal");
+    EXPECT_TRUE(process.GetRiseTime() == 20);
+    EXPECT_TRUE(process.GetFlatTop() == 10);
+    EXPECT_TRUE(process.GetDecayTime() == 50);
+}
+
+TEST(TRestRawSignalRecursiveFilterProcess, Trapezoid) {
+    TRestRawSignalRecursiveFilterProcess process(restRawSignalRecursiveFilterProcessRml.c_str());
+    process.InitProcess();
+
+    // An exponential pulse of amplitude 1000 starting at bin 100, and a signal outside the signals range
+    TRestRawSignalEvent event;
+    for (int id : {2, 1}) {
+        TRestRawSignal signal;
+        signal.SetSignalID(id);
+        for (int n = 0; n < 512; n++)
+            signal.AddRoundedPoint(100 + (n >= 100 ? 1000 * TMath::Exp(-(n - 100) / 50.) : 0));
+        event.AddSignal(signal);
+    }
+
+    const auto output = (TRestRawSignalEvent*)process.ProcessEvent(&event);
+
+    // The output keeps the order of the input signals, and the signal 2 is not filtered
+    ASSERT_EQ(output->GetNumberOfSignals(), 2);
+    EXPECT_EQ(output->GetSignal(0)->GetID(), 2);
+    EXPECT_EQ(output->GetSignal(1)->GetID(), 1);
+    for (int n = 0; n < 512; n++)
+        EXPECT_EQ(output->GetSignal(0)->GetRawData(n), event.GetSignal(0)->GetRawData(n));
+
+    // The decay is corrected, giving a trapezoid with the pulse amplitude at its flat top, and no baseline
+    const TRestRawSignal* filtered = output->GetSignal(1);
+    ASSERT_EQ(filtered->GetNumberOfPoints(), 512);
+    for (int n = 0; n < 100; n++) EXPECT_NEAR(filtered->GetRawData(n), 0, 1);
+    for (int n = 120; n < 130; n++) EXPECT_NEAR(filtered->GetRawData(n), 1000, 5);
+    for (int n = 150; n < 512; n++) EXPECT_NEAR(filtered->GetRawData(n), 0, 5);
+}
@@ -0,0 +1,78 @@
+#include <TMath.h>
+#include <TRestRawSignalTemplateBuilderProcess.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+using namespace std;
+
+const auto filesPath = fs::path(__FILE__).parent_path().parent_path() / "files";
+const auto restRawSignalTemplateBuilderProcessRml = filesPath / "TRestRawSignalTemplateBuilderProcess.rml";
+
+namespace {
+// The pulse shape, with unit amplitude at t = 0
+Double_t Shape(Double_t t) { return TMath::Exp(-t * t / 18); }
+
+// An event with a pulse of the given amplitude and time at each signal
+TRestRawSignalEvent PulsesEvent(const vector<pair<Double_t, Double_t>>& pulses) {
+    TRestRawSignalEvent event;
+    for (size_t s = 0; s < pulses.size(); s++) {
+        TRestRawSignal signal;
+        signal.SetSignalID(s);
+        for (int n = 0; n < 512; n++)
+            signal.AddRoundedPoint(100 + pulses[s].first * Shape(n - pulses[s].second));
+        event.AddSignal(signal);
+    }
+    return event;
+}
+}  // namespace
+
+TEST(TRestRawSignalTemplateBuilderProcess, TestFiles) {
+    cout << "Test files path: " << filesPath << endl;
+
+    // Check dir exists and is a directory
+    EXPECT_TRUE(fs::is_directory(filesPath));
+    // Check it's not empty
+    EXPECT_TRUE(!fs::is_empty(filesPath));
+    EXPECT_TRUE(fs::exists(restRawSignalTemplateBuilderProcessRml));
+}
+
+TEST(TRestRawSignalTemplateBuilderProcess, Default) {
+    TRestRawSignalTemplateBuilderProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "rawSignalTemplateBuilder");
+
+    EXPECT_TRUE(process.GetPreTrigger() == 128);
+    EXPECT_TRUE(process.GetTemplates().empty());
+}
+
+TEST(TRestRawSignalTemplateBuilderProcess, Template) {
+    // Two instances of the process, as if they were running at different threads
+    TRestRawSignalTemplateBuilderProcess first(restRawSignalTemplateBuilderProcessRml.c_str());
+    TRestRawSignalTemplateBuilderProcess second(restRawSignalTemplateBuilderProcessRml.c_str());
+    EXPECT_TRUE(first.GetPreTrigger() == 16);
+
+    first.InitProcess();
+    second.InitProcess();
+
+    // The pulses outside the amplitude range are not used
+    TRestRawSignalEvent firstEvent = PulsesEvent({{500, 200}, {300, 240.25}, {800, 300.5}, {50, 200}});
+    TRestRawSignalEvent secondEvent = PulsesEvent({{400, 150.75}, {2000, 200}, {600, 350.4}});
+    first.ProcessEvent(&firstEvent);
+    second.ProcessEvent(&secondEvent);
+
+    // The template is only available once the last instance has finished
+    first.EndProcess();
+    EXPECT_TRUE(first.GetTemplates().empty());
+    second.EndProcess();
+
+    for (const auto process : {&first, &second}) {
+        ASSERT_EQ(process->GetTemplateEntries().count(-1), 1);
+        EXPECT_EQ(process->GetTemplateEntries().at(-1), 5);
+
+        const vector<Float_t> pulse = process->GetTemplate();
+        ASSERT_EQ(pulse.size(), 64);
+        for (int i = 0; i < 64; i++) EXPECT_NEAR(pulse[i], Shape(i - 16), 0.02);
+    }
+}
@@ -0,0 +1,93 @@
+#include <TRestRawSignalToHitListProcess.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+using namespace std;
+
+const auto filesPath = fs::path(__FILE__).parent_path().parent_path() / "files";
+const auto restRawSignalToHitListProcessRml = filesPath / "TRestRawSignalToHitListProcess.rml";
+
+namespace {
+// A signal with a small baseline fluctuation, and triangular pulses of 20 bins starting at the given bins
+TRestRawSignal Pulses(Int_t id, const vector<pair<Int_t, Double_t>>& pulses) {
+    TRestRawSignal signal;
+    signal.SetSignalID(id);
+    for (int n = 0; n < 256; n++) {
+        Double_t value = 100 + (n * 7 + id) % 5;
+        for (const auto& pulse : pulses) {
+            const Int_t t0 = pulse.first;
+            if (n >= t0 && n < t0 + 20) value += pulse.second * (10 - abs(n - t0 - 10)) / 10;
+        }
+        signal.AddPoint((Short_t)value);
+    }
+    return signal;
+}
+
+// An event with a pile-up of two pulses at the signal 1, a single pulse at the signal 2, no pulse at the
+// signal 3, and two separated pulses at the signal 4
+TRestRawSignalEvent HandBuiltEvent() {
+    TRestRawSignalEvent event;
+    vector<TRestRawSignal> signals = {Pulses(1, {{100, 200}, {115, 150}}), Pulses(2, {{150, 100}}),
+                                      Pulses(3, {}), Pulses(4, {{100, 100}, {180, 100}})};
+    for (auto& signal : signals) event.AddSignal(signal);
+    return event;
+}
+}  // namespace
+
+TEST(TRestRawSignalToHitListProcess, TestFiles) {
+    cout << "Test files path: " << filesPath << endl;
+
+    // Check dir exists and is a directory
+    EXPECT_TRUE(fs::is_directory(filesPath));
+    // Check it's not empty
+    EXPECT_TRUE(!fs::is_empty(filesPath));
+    EXPECT_TRUE(fs::exists(restRawSignalToHitListProcessRml));
+}
+
+TEST(TRestRawSignalToHitListProcess, Default) {
+    TRestRawSignalToHitListProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "rawSignalToHitList");
+
+    EXPECT_TRUE(process.GetPulseHysteresis() == -1);
+}
+
+TEST(TRestRawSignalToHitListProcess, FromRml) {
+    TRestRawSignalToHitListProcess process(restRawSignalToHitListProcessRml.c_str());
+
+    process.PrintMetadata();
+
+    EXPECT_TRUE(process.GetPulseHysteresis() == 4);
+}
+
+TEST(TRestRawSignalToHitListProcess, OneHitPerSignal) {
+    TRestRawSignalToHitListProcess process;
+    process.InitProcess();
+
+    TRestRawSignalEvent event = HandBuiltEvent();
+    const auto output = (TRestRawHitListEvent*)process.ProcessEvent(&event);
+
+    ASSERT_EQ(output->GetNumberOfHits(), 3);
+    EXPECT_EQ(output->GetSignalIds(), vector<Int_t>({1, 2, 4}));
+    EXPECT_NEAR(output->GetTime(1), 160, 0.5);
+    EXPECT_NEAR(output->GetAmplitude(1), 100, 5);
+}
+
+TEST(TRestRawSignalToHitListProcess, PileUp) {
+    TRestRawSignalToHitListProcess process(restRawSignalToHitListProcessRml.c_str());
+    process.InitProcess();
+
+    TRestRawSignalEvent event = HandBuiltEvent();
+    const auto output = (TRestRawHitListEvent*)process.ProcessEvent(&event);
+
+    // The pulses are split at the minima deeper than the hysteresis
+    ASSERT_EQ(output->GetNumberOfHits(), 5);
+    EXPECT_EQ(output->GetSignalIds(), vector<Int_t>({1, 1, 2, 4, 4}));
+    EXPECT_NEAR(output->GetTime(0), 110, 0.5);
+    EXPECT_NEAR(output->GetTime(1), 125, 0.5);
+    EXPECT_NEAR(output->GetTime(2), 160, 0.5);
+    EXPECT_NEAR(output->GetTime(3), 110, 0.5);
+    EXPECT_NEAR(output->GetTime(4), 190, 0.5);
+}
@@ -0,0 +1,68 @@
+#include <TRestRawSignalWaveletDenoisingProcess.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+namespace fs = std::filesystem;
+
+using namespace std;
+
+const auto filesPath = fs::path(__FILE__).parent_path().parent_path() / "files";
+const auto restRawSignalWaveletDenoisingProcessRml = filesPath / "TRestRawSignalWaveletDenoisingProcess.rml";
+
+TEST(TRestRawSignalWaveletDenoisingProcess, TestFiles) {
+    cout << "Test files path: " << filesPath << endl;
+
+    // Check dir exists and is a directory
+    EXPECT_TRUE(fs::is_directory(filesPath));
+    // Check it's not empty
+    EXPECT_TRUE(!fs::is_empty(filesPath));
+    EXPECT_TRUE(fs::exists(restRawSignalWaveletDenoisingProcessRml));
+}
+
+TEST(TRestRawSignalWaveletDenoisingProcess, Default) {
+    TRestRawSignalWaveletDenoisingProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "rawSignalWaveletDenoising");
+
+    EXPECT_TRUE(process.GetLevels() == 4);
+    EXPECT_TRUE(process.GetThresholdType() == "soft");
+    EXPECT_TRUE(process.GetNSigmas() == 3);
+}
+
+TEST(TRestRawSignalWaveletDenoisingProcess, FromRml) {
+    TRestRawSignalWaveletDenoisingProcess process(restRawSignalWaveletDenoisingProcessRml.c_str());
+
+    process.PrintMetadata();
+
+    EXPECT_TRUE(process.GetLevels() == 3);
+    EXPECT_TRUE(process.GetThresholdType() == "soft");
+    EXPECT_TRUE(process.GetNSigmas() == 0);
+}
+
+TEST(TRestRawSignalWaveletDenoisingProcess, RoundTrip) {
+    // With null thresholds the inverse transform must rebuild the input exactly
+    TRestRawSignalWaveletDenoisingProcess process(restRawSignalWaveletDenoisingProcessRml.c_str());
+
+    TRestRawSignalEvent event;
+    for (int id = 2; id >= 0; id--) {
+        TRestRawSignal signal;
+        signal.SetSignalID(id);
+        // An odd number of points, so that the edges of every level are exercised
+        for (int i = 0; i < 301; i++) signal.AddPoint((Short_t)(200 + (i * 7919 + id * 104729) % 613 - 300));
+        event.AddSignal(signal);
+    }
+
+    process.InitProcess();
+    const auto output = (TRestRawSignalEvent*)process.ProcessEvent(&event);
+
+    // The signal 0 is outside the signals range, and the output keeps the input order
+    ASSERT_EQ(output->GetNumberOfSignals(), 3);
+    for (int s = 0; s < 3; s++) {
+        const TRestRawSignal* input = event.GetSignal(s);
+        const TRestRawSignal* denoised = output->GetSignal(s);
+        EXPECT_EQ(denoised->GetID(), input->GetID());
+        ASSERT_EQ(denoised->GetNumberOfPoints(), input->GetNumberOfPoints());
+        for (int i = 0; i < input->GetNumberOfPoints(); i++)
+            EXPECT_EQ(denoised->GetRawData(i), input->GetRawData(i));
+    }
+}
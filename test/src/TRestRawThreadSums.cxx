@@ -0,0 +1,79 @@
+#include <TRestRawThreadSums.h>
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace {
+/// An instance of a process, receiving the merged sums
+struct Instance {
+    TRestRawThreadSums::Sums received;
+    Int_t calls = 0;
+
+    void Register(const string& name) {
+        TRestRawThreadSums::Register(name, this, [this](const TRestRawThreadSums::Sums& sums) {
+            received = sums;
+            calls++;
+        });
+    }
+
+    ~Instance() { TRestRawThreadSums::Unregister(this); }
+};
+
+TRestRawThreadSums::Sums Sums(Int_t channel, const vector<Double_t>& values) {
+    return {{"sums", {{channel, values}}}};
+}
+}  // namespace
+
+TEST(TRestRawThreadSums, Merge) {
+    Instance first, second, other;
+    first.Register("merge");
+    second.Register("merge");
+    other.Register("mergeOther");
+
+    // The sums are placed in the instances once the last one has merged
+    EXPECT_FALSE(TRestRawThreadSums::Merge("merge", &first, Sums(1, {1, 2})));
+    EXPECT_EQ(first.calls, 0);
+    EXPECT_TRUE(TRestRawThreadSums::Merge("merge", &second, Sums(1, {10, 20, 30})));
+
+    const vector<Double_t> expected = {11, 22, 30};
+    EXPECT_EQ(first.calls, 1);
+    EXPECT_EQ(second.calls, 1);
+    EXPECT_EQ(first.received["sums"][1], expected);
+    EXPECT_EQ(second.received["sums"][1], expected);
+
+    // The instances with a different name are not affected
+    EXPECT_EQ(other.calls, 0);
+    EXPECT_TRUE(TRestRawThreadSums::Merge("mergeOther", &other, Sums(2, {5})));
+    EXPECT_EQ(other.received["sums"].count(1), 0);
+
+    // A new run starts from empty sums
+    first.Register("merge");
+    second.Register("merge");
+    TRestRawThreadSums::Merge("merge", &first, Sums(1, {1}));
+    TRestRawThreadSums::Merge("merge", &second, Sums(1, {1}));
+    EXPECT_EQ(first.received["sums"][1], vector<Double_t>({2}));
+}
+
+TEST(TRestRawThreadSums, AbortedRun) {
+    Instance first, second;
+    first.Register("aborted");
+    second.Register("aborted");
+    TRestRawThreadSums::Merge("aborted", &first, Sums(1, {100}));
+
+    // The second instance did not reach its EndProcess, and the next run must not wait for it,
+    // nor include the sums of the aborted run
+    first.Register("aborted");
+    second.Register("aborted");
+    EXPECT_FALSE(TRestRawThreadSums::Merge("aborted", &first, Sums(1, {1})));
+    EXPECT_TRUE(TRestRawThreadSums::Merge("aborted", &second, Sums(1, {2})));
+    EXPECT_EQ(first.received["sums"][1], vector<Double_t>({3}));
+
+    // A deleted instance is not waited for
+    {
+        Instance third;
+        first.Register("aborted");
+        third.Register("aborted");
+    }
+    EXPECT_TRUE(TRestRawThreadSums::Merge("aborted", &first, Sums(1, {4})));
+    EXPECT_EQ(first.received["sums"][1], vector<Double_t>({4}));
+}
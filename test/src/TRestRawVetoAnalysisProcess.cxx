@@ -0,0 +1,34 @@
+#include <TRestRawVetoAnalysisProcess.h>
+#include <gtest/gtest.h>
+
+using namespace std;
+
+TEST(TRestRawVetoAnalysisProcess, Default) {
+    TRestRawVetoAnalysisProcess process;
+    EXPECT_TRUE(process.GetProcessName() == (std::string) "vetoAnalysis");
+}
+
+TEST(TRestRawVetoAnalysisProcess, VetoHitsBuffer) {
+    TRestRawVetoAnalysisProcess process;
+    process.InitProcess();
+    EXPECT_EQ(process.CountVetoHits(0), 0);
+
+    // The hits are usually added in time order, but a late hit is inserted at its sorted position
+    for (const auto& time : {1.0, 2.0, 3.0, 5.0, 4.0, 2.5}) process.AddVetoHit(time);
+
+    EXPECT_EQ(process.CountVetoHits(0), 6);
+    EXPECT_EQ(process.CountVetoHits(2.5), 4);
+    EXPECT_EQ(process.CountVetoHits(3.5), 2);
+    EXPECT_EQ(process.CountVetoHits(5.0), 1);
+    EXPECT_EQ(process.CountVetoHits(5.5), 0);
+
+    // Only the most recent hits are kept, 4096 by default
+    for (int n = 0; n < 5000; n++) process.AddVetoHit(10 + n);
+    EXPECT_EQ(process.CountVetoHits(0), 4096);
+    EXPECT_EQ(process.CountVetoHits(10 + 5000 - 4096), 4096);
+    EXPECT_EQ(process.CountVetoHits(10 + 4999), 1);
+
+    // The buffer is cleared for a new run
+    process.InitProcess();
+    EXPECT_EQ(process.CountVetoHits(0), 0);
+}